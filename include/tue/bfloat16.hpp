@@ -0,0 +1,383 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "detail_/float_bits.hpp"
+#include "simd.hpp"
+
+#ifdef TUE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef TUE_AVX512BF16
+#include <immintrin.h>
+#endif
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline std::uint16_t float32_to_bfloat16_bits(float x) noexcept
+        {
+            const auto u = tue::detail_::float_bits(x);
+            if ((u & 0x7FFFFFFFu) > 0x7F800000u)
+            {
+                // Keep the sign and the top of the payload, but make sure
+                // truncation can't turn the NaN into an Inf.
+                return static_cast<std::uint16_t>((u >> 16) | 0x0040u);
+            }
+
+            const auto lsb = (u >> 16) & 1u;
+            return static_cast<std::uint16_t>((u + 0x7FFFu + lsb) >> 16);
+        }
+
+        inline float bfloat16_bits_to_float32(std::uint16_t b) noexcept
+        {
+            return tue::detail_::bits_float(std::uint32_t(b) << 16);
+        }
+    }
+
+    /*!
+     * \defgroup  bfloat16_hpp <tue/bfloat16.hpp>
+     *
+     * \brief     The `bfloat16` storage type and its associated conversion
+     *            functions.
+     * @{
+     */
+
+    /*!
+     * \brief    A 16-bit brain floating-point value (the upper half of an
+     *           IEEE 754 single-precision value).
+     * \details  `bfloat16` is a storage type only. It doesn't define any
+     *           arithmetic operators. Convert to `float` (or to `float32x4`,
+     *           `float32x8`, etc. with `load_bfloat16()`) to do math with it.
+     *           Conversions from `float` round to nearest even.
+     */
+    class bfloat16
+    {
+        std::uint16_t bits_;
+
+        struct from_bits_tag {};
+
+        constexpr bfloat16(std::uint16_t bits, from_bits_tag) noexcept
+        :
+            bits_(bits)
+        {
+        }
+
+    public:
+        /*!
+         * \brief  Default constructs a `bfloat16` with an indeterminate
+         *         value.
+         */
+        bfloat16() noexcept = default;
+
+        /*!
+         * \brief    Constructs a `bfloat16` with the value of `x` rounded to
+         *           the nearest representable `bfloat16` value.
+         *
+         * \param x  The value to convert.
+         */
+        explicit bfloat16(float x) noexcept
+        :
+            bits_(tue::detail_::float32_to_bfloat16_bits(x))
+        {
+        }
+
+        /*!
+         * \brief       Constructs a `bfloat16` from its binary
+         *              representation.
+         *
+         * \param bits  The binary representation.
+         *
+         * \return      The new `bfloat16`.
+         */
+        static constexpr bfloat16 from_bits(std::uint16_t bits) noexcept
+        {
+            return bfloat16(bits, from_bits_tag());
+        }
+
+        /*!
+         * \brief   Returns the binary representation of this `bfloat16`.
+         *
+         * \return  The binary representation of this `bfloat16`.
+         */
+        constexpr std::uint16_t bits() const noexcept
+        {
+            return bits_;
+        }
+
+        /*!
+         * \brief   Converts this `bfloat16` to a `float`. The conversion is
+         *          exact.
+         *
+         * \return  This `bfloat16` as a `float`.
+         */
+        explicit operator float() const noexcept
+        {
+            return tue::detail_::bfloat16_bits_to_float32(bits_);
+        }
+    };
+
+    /*!@}*/
+
+    static_assert(sizeof(bfloat16) == 2, "bfloat16 is not 16-bits wide");
+
+    namespace detail_
+    {
+#ifdef TUE_SSE2
+        inline __m128 bfloat16x4_to_float32x4(__m128i b) noexcept
+        {
+            // Interleaving zeros below each value is the whole conversion
+            return _mm_castsi128_ps(
+                _mm_unpacklo_epi16(_mm_setzero_si128(), b));
+        }
+
+        inline __m128i float32x4_to_bfloat16x4(__m128 f) noexcept
+        {
+#ifdef TUE_AVX512BF16
+            return reinterpret_cast<__m128i>(_mm_cvtneps_pbh(f));
+#else
+            const auto u = _mm_castps_si128(f);
+            const auto lsb = _mm_and_si128(
+                _mm_srli_epi32(u, 16), _mm_set1_epi32(1));
+            const auto rounded = _mm_add_epi32(
+                u, _mm_add_epi32(_mm_set1_epi32(0x7FFF), lsb));
+
+            const auto b_isnan = _mm_castps_si128(_mm_cmpunord_ps(f, f));
+            const auto quieted = _mm_or_si128(u, _mm_set1_epi32(0x00400000));
+            const auto result = _mm_or_si128(
+                _mm_and_si128(b_isnan, quieted),
+                _mm_andnot_si128(b_isnan, rounded));
+
+            // Shifting arithmetically keeps every value in int16_t range so
+            // the saturating pack below is exact.
+            const auto shifted = _mm_srai_epi32(result, 16);
+            return _mm_packs_epi32(shifted, shifted);
+#endif
+        }
+#endif
+
+        template<int N>
+        struct bfloat16_utils
+        {
+            static simd<float, N> load(const bfloat16* data) noexcept
+            {
+                simd<float, N> result;
+                const auto rimpl =
+                    reinterpret_cast<simd<float, N/2>*>(&result);
+                rimpl[0] = bfloat16_utils<N/2>::load(data);
+                rimpl[1] = bfloat16_utils<N/2>::load(data + N/2);
+                return result;
+            }
+
+            static void store(
+                const simd<float, N>& s, bfloat16* data) noexcept
+            {
+                const auto simpl =
+                    reinterpret_cast<const simd<float, N/2>*>(&s);
+                bfloat16_utils<N/2>::store(simpl[0], data);
+                bfloat16_utils<N/2>::store(simpl[1], data + N/2);
+            }
+        };
+
+        template<>
+        struct bfloat16_utils<2>
+        {
+            static float32x2 load(const bfloat16* data) noexcept
+            {
+                return { float(data[0]), float(data[1]) };
+            }
+
+            static void store(const float32x2& s, bfloat16* data) noexcept
+            {
+                data[0] = bfloat16(s.data()[0]);
+                data[1] = bfloat16(s.data()[1]);
+            }
+        };
+
+        template<>
+        struct bfloat16_utils<4>
+        {
+            static float32x4 load(const bfloat16* data) noexcept
+            {
+#ifdef TUE_SSE2
+                return tue::detail_::bfloat16x4_to_float32x4(
+                    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+#else
+                return {
+                    float(data[0]), float(data[1]),
+                    float(data[2]), float(data[3]),
+                };
+#endif
+            }
+
+            static void store(const float32x4& s, bfloat16* data) noexcept
+            {
+#ifdef TUE_SSE2
+                _mm_storel_epi64(
+                    reinterpret_cast<__m128i*>(data),
+                    tue::detail_::float32x4_to_bfloat16x4(s));
+#else
+                data[0] = bfloat16(s.data()[0]);
+                data[1] = bfloat16(s.data()[1]);
+                data[2] = bfloat16(s.data()[2]);
+                data[3] = bfloat16(s.data()[3]);
+#endif
+            }
+        };
+
+#ifdef TUE_AVX512BF16
+        // Widening each value to 32 bits and shifting it into the upper
+        // half is the whole conversion, and AVX-512 BF16 can narrow a full
+        // 256-bit or 512-bit register at once.
+        template<>
+        struct bfloat16_utils<8>
+        {
+            static float32x8 load(const bfloat16* data) noexcept
+            {
+                alignas(float32x8) float lanes[8];
+                _mm256_store_si256(
+                    reinterpret_cast<__m256i*>(lanes),
+                    _mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(data))), 16));
+                return float32x8::load(lanes);
+            }
+
+            static void store(const float32x8& s, bfloat16* data) noexcept
+            {
+                alignas(float32x8) float lanes[8];
+                s.store(lanes);
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(data),
+                    reinterpret_cast<__m128i>(
+                        _mm256_cvtneps_pbh(_mm256_load_ps(lanes))));
+            }
+        };
+
+        template<>
+        struct bfloat16_utils<16>
+        {
+            static float32x16 load(const bfloat16* data) noexcept
+            {
+                alignas(float32x16) float lanes[16];
+                _mm512_store_si512(
+                    lanes,
+                    _mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(data))), 16));
+                return float32x16::load(lanes);
+            }
+
+            static void store(const float32x16& s, bfloat16* data) noexcept
+            {
+                alignas(float32x16) float lanes[16];
+                s.store(lanes);
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(data),
+                    reinterpret_cast<__m256i>(
+                        _mm512_cvtneps_pbh(_mm512_load_ps(lanes))));
+            }
+        };
+#endif
+    }
+
+    /*!
+     * \addtogroup  bfloat16_hpp
+     * @{
+     */
+
+    /*!
+     * \brief       Loads `N` consecutive `bfloat16` values and converts them
+     *              to an `N`-component `float` SIMD vector.
+     * \details     `data` doesn't need to be aligned.
+     *
+     * \tparam N    The component count of the returned `simd`.
+     *
+     * \param data  A pointer to at least `N` `bfloat16` values.
+     *
+     * \return      The converted `simd`.
+     */
+    template<int N>
+    inline simd<float, N> load_bfloat16(const bfloat16* data) noexcept
+    {
+        return tue::detail_::bfloat16_utils<N>::load(data);
+    }
+
+    /*!
+     * \brief       Converts each component of `s` to `bfloat16` (rounding to
+     *              nearest even) and stores them to `N` consecutive
+     *              `bfloat16` values.
+     * \details     `data` doesn't need to be aligned. Conversion uses AVX-512
+     *              BF16 intrinsics (up to 16 components at a time) when
+     *              `TUE_AVX512BF16` is defined, which flush subnormal inputs
+     *              to zero, and an SSE2 integer fallback when only
+     *              `TUE_SSE2` is defined.
+     *
+     * \tparam N    The component count of `s`.
+     *
+     * \param s     The `simd` to convert.
+     * \param data  A pointer to at least `N` `bfloat16` values.
+     */
+    template<int N>
+    inline void store_bfloat16(
+        const simd<float, N>& s, bfloat16* data) noexcept
+    {
+        tue::detail_::bfloat16_utils<N>::store(s, data);
+    }
+
+    /*!
+     * \brief        Converts `count` `bfloat16` values to `float`.
+     *
+     * \param src    A pointer to the values to convert.
+     * \param count  The number of values to convert.
+     * \param dst    A pointer to where the converted values will be stored.
+     */
+    inline void convert_n(
+        const bfloat16* src, std::size_t count, float* dst) noexcept
+    {
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            tue::load_bfloat16<4>(src + i).storeu(dst + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            dst[i] = float(src[i]);
+        }
+    }
+
+    /*!
+     * \brief        Converts `count` `float` values to `bfloat16` (rounding
+     *               to nearest even).
+     *
+     * \param src    A pointer to the values to convert.
+     * \param count  The number of values to convert.
+     * \param dst    A pointer to where the converted values will be stored.
+     */
+    inline void convert_n(
+        const float* src, std::size_t count, bfloat16* dst) noexcept
+    {
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            tue::store_bfloat16(float32x4::loadu(src + i), dst + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            dst[i] = bfloat16(src[i]);
+        }
+    }
+
+    /*!@}*/
+}
@@ -0,0 +1,32 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline std::uint32_t float_bits(float x) noexcept
+        {
+            std::uint32_t u;
+            std::memcpy(&u, &x, sizeof(u));
+            return u;
+        }
+
+        inline float bits_float(std::uint32_t u) noexcept
+        {
+            float x;
+            std::memcpy(&x, &u, sizeof(x));
+            return x;
+        }
+    }
+}
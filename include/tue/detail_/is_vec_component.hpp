@@ -21,6 +21,15 @@ namespace tue
     template<typename T, int N>
     class simd;
 
+    template<typename T>
+    class unorm;
+
+    template<typename T>
+    class snorm;
+
+    template<int IntBits, int FracBits>
+    class fixed;
+
     template<typename T>
     struct is_vec_component
     :
@@ -141,6 +150,30 @@ namespace tue
         using std::integral_constant<bool, true>::integral_constant;
     };
 
+    template<typename T>
+    struct is_vec_component<unorm<T>>
+    :
+        public std::integral_constant<bool, true>
+    {
+        using std::integral_constant<bool, true>::integral_constant;
+    };
+
+    template<typename T>
+    struct is_vec_component<snorm<T>>
+    :
+        public std::integral_constant<bool, true>
+    {
+        using std::integral_constant<bool, true>::integral_constant;
+    };
+
+    template<int IntBits, int FracBits>
+    struct is_vec_component<fixed<IntBits, FracBits>>
+    :
+        public std::integral_constant<bool, true>
+    {
+        using std::integral_constant<bool, true>::integral_constant;
+    };
+
     template<typename T, int N>
     struct is_vec_component<simd<T, N>>
     :
@@ -0,0 +1,341 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <utility>
+
+#include "../mat.hpp"
+#include "../math.hpp"
+#include "../simd.hpp"
+#include "../vec.hpp"
+
+// Everything in here is branch-free so the same code works on scalars and on
+// every lane of a simd type at once. Iteration counts are fixed instead of
+// depending on convergence, and any choice that would be a branch is made
+// with tue::math::select() instead.
+
+namespace tue
+{
+    namespace detail_
+    {
+        // The number of cyclic Jacobi sweeps. Convergence is quadratic, so
+        // this is enough for double precision with room to spare.
+        constexpr int eigen_symmetric_sweeps = 6;
+
+        template<typename T>
+        inline void select_swap(
+            const decltype(tue::math::less(
+                std::declval<T>(), std::declval<T>()))& condition,
+            T& a, T& b) noexcept
+        {
+            const auto a2 = tue::math::select(condition, b, a);
+            b = tue::math::select(condition, a, b);
+            a = a2;
+        }
+
+        // Applies the Jacobi rotation that zeroes a[p][q] to the symmetric
+        // matrix a and accumulates it into the columns of v.
+        template<typename T>
+        inline void jacobi_rotate(
+            mat<T, 3, 3>& a, mat<T, 3, 3>& v, int p, int q) noexcept
+        {
+            const int r = 3 - p - q;
+            const auto apq = a[p][q];
+            const auto d = a[q][q] - a[p][p];
+
+            // t = tan(angle) is the smaller root of t^2 + (d/apq)t - 1 = 0,
+            // written so it's 0 instead of NaN when apq is 0.
+            const auto denom = tue::math::abs(d)
+                + tue::math::sqrt(d*d + T(4.0f)*apq*apq);
+            const auto nonzero = tue::math::greater(denom, T(0.0f));
+            const auto sign = tue::math::select(
+                tue::math::less(d, T(0.0f)), T(-1.0f), T(1.0f));
+            const auto t = tue::math::select(nonzero,
+                T(2.0f) * sign * apq
+                    / tue::math::select(nonzero, denom, T(1.0f)),
+                T(0.0f));
+            const auto c = T(1.0f) / tue::math::sqrt(t*t + T(1.0f));
+            const auto s = t * c;
+
+            const auto arp = a[r][p];
+            const auto arq = a[r][q];
+            a[p][p] -= t * apq;
+            a[q][q] += t * apq;
+            a[p][q] = a[q][p] = T(0.0f);
+            a[r][p] = a[p][r] = c*arp - s*arq;
+            a[r][q] = a[q][r] = s*arp + c*arq;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                const auto vkp = v[p][k];
+                const auto vkq = v[q][k];
+                v[p][k] = c*vkp - s*vkq;
+                v[q][k] = s*vkp + c*vkq;
+            }
+        }
+
+        template<typename T>
+        inline void eigen_symmetric_m(
+            const mat<T, 3, 3>& m,
+            vec<T, 3>& eigenvalues, mat<T, 3, 3>& eigenvectors) noexcept
+        {
+            auto a = m;
+            mat<T, 3, 3> v = {
+                { T(1.0f), T(0.0f), T(0.0f) },
+                { T(0.0f), T(1.0f), T(0.0f) },
+                { T(0.0f), T(0.0f), T(1.0f) },
+            };
+
+            for (int sweep = 0; sweep < eigen_symmetric_sweeps; ++sweep)
+            {
+                tue::detail_::jacobi_rotate(a, v, 0, 1);
+                tue::detail_::jacobi_rotate(a, v, 0, 2);
+                tue::detail_::jacobi_rotate(a, v, 1, 2);
+            }
+
+            // Sort from largest to smallest with a three-comparison network
+            vec<T, 3> w(a[0][0], a[1][1], a[2][2]);
+            const int pairs[3][2] = { { 0, 1 }, { 1, 2 }, { 0, 1 } };
+            for (const auto& pair : pairs)
+            {
+                const int i = pair[0];
+                const int j = pair[1];
+                const auto swap = tue::math::less(w[i], w[j]);
+                tue::detail_::select_swap(swap, w[i], w[j]);
+                for (int k = 0; k < 3; ++k)
+                {
+                    tue::detail_::select_swap(swap, v[i][k], v[j][k]);
+                }
+            }
+
+            eigenvalues = w;
+            eigenvectors = v;
+        }
+
+        // Applies the Givens rotation that zeroes b[p][q] (row q of column
+        // p) to rows p and q of b and accumulates its transpose into the
+        // columns of u, so u * b is unchanged.
+        template<typename T>
+        inline void givens_qr_rotate(
+            mat<T, 3, 3>& b, mat<T, 3, 3>& u, int p, int q) noexcept
+        {
+            const auto a1 = b[p][p];
+            const auto a2 = b[p][q];
+            const auto rho = tue::math::sqrt(a1*a1 + a2*a2);
+            const auto nonzero = tue::math::greater(rho, T(0.0f));
+            const auto rrho = T(1.0f)
+                / tue::math::select(nonzero, rho, T(1.0f));
+            const auto c = tue::math::select(nonzero, a1 * rrho, T(1.0f));
+            const auto s = tue::math::select(nonzero, a2 * rrho, T(0.0f));
+
+            for (int k = 0; k < 3; ++k)
+            {
+                const auto bp = b[k][p];
+                const auto bq = b[k][q];
+                b[k][p] = c*bp + s*bq;
+                b[k][q] = c*bq - s*bp;
+
+                const auto up = u[p][k];
+                const auto uq = u[q][k];
+                u[p][k] = c*up + s*uq;
+                u[q][k] = c*uq - s*up;
+            }
+        }
+
+        template<typename T>
+        inline void svd_m(
+            const mat<T, 3, 3>& m,
+            mat<T, 3, 3>& u, vec<T, 3>& s, mat<T, 3, 3>& v) noexcept
+        {
+            // The right singular vectors are the eigenvectors of
+            // transpose(m) * m. Sorting by eigenvalue sorts the columns of
+            // m * v by length.
+            vec<T, 3> w;
+            tue::detail_::eigen_symmetric_m(
+                tue::detail_::transpose_m(m) * m, w, v);
+
+            // Make v a rotation
+            const auto flip = tue::math::less(
+                tue::math::dot(v[0], tue::math::cross(v[1], v[2])),
+                T(0.0f));
+            for (int k = 0; k < 3; ++k)
+            {
+                v[2][k] = tue::math::select(flip, -v[2][k], v[2][k]);
+            }
+
+            // m * v has orthogonal columns, so its QR decomposition is u
+            // times a diagonal matrix of the singular values.
+            auto b = m * v;
+            u = {
+                { T(1.0f), T(0.0f), T(0.0f) },
+                { T(0.0f), T(1.0f), T(0.0f) },
+                { T(0.0f), T(0.0f), T(1.0f) },
+            };
+
+            tue::detail_::givens_qr_rotate(b, u, 0, 1);
+            tue::detail_::givens_qr_rotate(b, u, 0, 2);
+            tue::detail_::givens_qr_rotate(b, u, 1, 2);
+            s = { b[0][0], b[1][1], b[2][2] };
+        }
+
+        // The solvers below index m as m[c][r] and b and x as b[i] and
+        // x[i], so they work the same on mat's and vec's as on plain
+        // arrays of any size.
+
+        // Solves m * x = b where m = L * transpose(L). l[j][i] is L(i, j)
+        // (i.e., row i of column j) and rd[j] is 1 / L(j, j).
+        template<typename T, int N, typename M, typename V, typename X>
+        inline void solve_cholesky_m(const M& m, const V& b, X& x) noexcept
+        {
+            T l[N][N];
+            T rd[N];
+            for (int j = 0; j < N; ++j)
+            {
+                auto d = m[j][j];
+                for (int k = 0; k < j; ++k)
+                {
+                    d -= l[k][j] * l[k][j];
+                }
+
+                rd[j] = T(1.0f) / tue::math::sqrt(d);
+                for (int i = j + 1; i < N; ++i)
+                {
+                    auto s = m[j][i];
+                    for (int k = 0; k < j; ++k)
+                    {
+                        s -= l[k][i] * l[k][j];
+                    }
+
+                    l[j][i] = s * rd[j];
+                }
+            }
+
+            for (int i = 0; i < N; ++i)
+            {
+                auto s = b[i];
+                for (int k = 0; k < i; ++k)
+                {
+                    s -= l[k][i] * x[k];
+                }
+
+                x[i] = s * rd[i];
+            }
+
+            for (int i = N - 1; i >= 0; --i)
+            {
+                auto s = x[i];
+                for (int k = i + 1; k < N; ++k)
+                {
+                    s -= l[i][k] * x[k];
+                }
+
+                x[i] = s * rd[i];
+            }
+        }
+
+        // Solves m * x = b where m = L * D * transpose(L) and L has a unit
+        // diagonal. l[j][i] is L(i, j) and rd[j] is 1 / D(j, j).
+        template<typename T, int N, typename M, typename V, typename X>
+        inline void solve_ldlt_m(const M& m, const V& b, X& x) noexcept
+        {
+            T l[N][N];
+            T d[N];
+            T rd[N];
+            for (int j = 0; j < N; ++j)
+            {
+                d[j] = m[j][j];
+                for (int k = 0; k < j; ++k)
+                {
+                    d[j] -= l[k][j] * l[k][j] * d[k];
+                }
+
+                rd[j] = T(1.0f) / d[j];
+                for (int i = j + 1; i < N; ++i)
+                {
+                    auto s = m[j][i];
+                    for (int k = 0; k < j; ++k)
+                    {
+                        s -= l[k][i] * l[k][j] * d[k];
+                    }
+
+                    l[j][i] = s * rd[j];
+                }
+            }
+
+            for (int i = 0; i < N; ++i)
+            {
+                x[i] = b[i];
+                for (int k = 0; k < i; ++k)
+                {
+                    x[i] -= l[k][i] * x[k];
+                }
+            }
+
+            for (int i = N - 1; i >= 0; --i)
+            {
+                auto s = x[i] * rd[i];
+                for (int k = i + 1; k < N; ++k)
+                {
+                    s -= l[i][k] * x[k];
+                }
+
+                x[i] = s;
+            }
+        }
+
+        // Solves m * x = b where m = L * U and L has a unit diagonal. Both
+        // are stored in lu the same way as m, and rd[j] is 1 / U(j, j).
+        template<typename T, int N, typename M, typename V, typename X>
+        inline void solve_lu_m(const M& m, const V& b, X& x) noexcept
+        {
+            T lu[N][N];
+            for (int c = 0; c < N; ++c)
+            {
+                for (int r = 0; r < N; ++r)
+                {
+                    lu[c][r] = m[c][r];
+                }
+            }
+
+            T rd[N];
+            for (int k = 0; k < N; ++k)
+            {
+                rd[k] = T(1.0f) / lu[k][k];
+                for (int i = k + 1; i < N; ++i)
+                {
+                    lu[k][i] *= rd[k];
+                    for (int j = k + 1; j < N; ++j)
+                    {
+                        lu[j][i] -= lu[k][i] * lu[j][k];
+                    }
+                }
+            }
+
+            for (int i = 0; i < N; ++i)
+            {
+                x[i] = b[i];
+                for (int k = 0; k < i; ++k)
+                {
+                    x[i] -= lu[k][i] * x[k];
+                }
+            }
+
+            for (int i = N - 1; i >= 0; --i)
+            {
+                auto s = x[i];
+                for (int k = i + 1; k < N; ++k)
+                {
+                    s -= lu[k][i] * x[k];
+                }
+
+                x[i] = s * rd[i];
+            }
+        }
+    }
+}
@@ -0,0 +1,299 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include "../mat.hpp"
+#include "../simd.hpp"
+#include "../vec.hpp"
+
+#ifdef TUE_SSE
+#include <xmmintrin.h>
+#endif
+
+// Since inverse(transpose(m)) == transpose(inverse(m)), everything in here
+// treats m[i][j] as the component in row i and column j. The results are the
+// same either way.
+
+namespace tue
+{
+    namespace detail_
+    {
+        template<typename T>
+        inline constexpr T determinant_m(const mat<T, 2, 2>& m) noexcept
+        {
+            return m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        }
+
+        template<typename T>
+        inline constexpr T determinant_m(const mat<T, 3, 3>& m) noexcept
+        {
+            return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+                 + m[0][1] * (m[1][2] * m[2][0] - m[1][0] * m[2][2])
+                 + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+        }
+
+        // The 2x2 minors of the first two and last two rows, shared by the
+        // 4x4 determinant and inverse.
+        template<typename T>
+        struct mat4_minors
+        {
+            T s0, s1, s2, s3, s4, s5;
+            T c0, c1, c2, c3, c4, c5;
+
+            constexpr mat4_minors(const mat<T, 4, 4>& m) noexcept
+            :
+                s0(m[0][0] * m[1][1] - m[1][0] * m[0][1]),
+                s1(m[0][0] * m[1][2] - m[1][0] * m[0][2]),
+                s2(m[0][0] * m[1][3] - m[1][0] * m[0][3]),
+                s3(m[0][1] * m[1][2] - m[1][1] * m[0][2]),
+                s4(m[0][1] * m[1][3] - m[1][1] * m[0][3]),
+                s5(m[0][2] * m[1][3] - m[1][2] * m[0][3]),
+                c0(m[2][0] * m[3][1] - m[3][0] * m[2][1]),
+                c1(m[2][0] * m[3][2] - m[3][0] * m[2][2]),
+                c2(m[2][0] * m[3][3] - m[3][0] * m[2][3]),
+                c3(m[2][1] * m[3][2] - m[3][1] * m[2][2]),
+                c4(m[2][1] * m[3][3] - m[3][1] * m[2][3]),
+                c5(m[2][2] * m[3][3] - m[3][2] * m[2][3])
+            {
+            }
+
+            constexpr T determinant() const noexcept
+            {
+                return s0 * c5 - s1 * c4 + s2 * c3
+                     + s3 * c2 - s4 * c1 + s5 * c0;
+            }
+        };
+
+        template<typename T>
+        inline constexpr T determinant_m(const mat<T, 4, 4>& m) noexcept
+        {
+            return mat4_minors<T>(m).determinant();
+        }
+
+        template<typename T>
+        inline constexpr mat<T, 2, 2> inverse_m(const mat<T, 2, 2>& m) noexcept
+        {
+            return mat<T, 2, 2>(
+                {  m[1][1], -m[0][1] },
+                { -m[1][0],  m[0][0] }) * (T(1) / determinant_m(m));
+        }
+
+        template<typename T>
+        inline constexpr mat<T, 3, 3> inverse_m(const mat<T, 3, 3>& m) noexcept
+        {
+            const vec<T, 3> c0 = {
+                m[1][1] * m[2][2] - m[1][2] * m[2][1],
+                m[1][2] * m[2][0] - m[1][0] * m[2][2],
+                m[1][0] * m[2][1] - m[1][1] * m[2][0],
+            };
+
+            const auto rdet = T(1) / (
+                m[0][0] * c0[0] + m[0][1] * c0[1] + m[0][2] * c0[2]);
+
+            return mat<T, 3, 3>(
+                {
+                    c0[0],
+                    m[0][2] * m[2][1] - m[0][1] * m[2][2],
+                    m[0][1] * m[1][2] - m[0][2] * m[1][1],
+                },
+                {
+                    c0[1],
+                    m[0][0] * m[2][2] - m[0][2] * m[2][0],
+                    m[0][2] * m[1][0] - m[0][0] * m[1][2],
+                },
+                {
+                    c0[2],
+                    m[0][1] * m[2][0] - m[0][0] * m[2][1],
+                    m[0][0] * m[1][1] - m[0][1] * m[1][0],
+                }) * rdet;
+        }
+
+        template<typename T>
+        inline constexpr mat<T, 4, 4> inverse_m(const mat<T, 4, 4>& m) noexcept
+        {
+            const mat4_minors<T> n(m);
+            const auto rdet = T(1) / n.determinant();
+
+            return mat<T, 4, 4>(
+                {
+                    m[1][1] * n.c5 - m[1][2] * n.c4 + m[1][3] * n.c3,
+                    m[0][2] * n.c4 - m[0][1] * n.c5 - m[0][3] * n.c3,
+                    m[3][1] * n.s5 - m[3][2] * n.s4 + m[3][3] * n.s3,
+                    m[2][2] * n.s4 - m[2][1] * n.s5 - m[2][3] * n.s3,
+                },
+                {
+                    m[1][2] * n.c2 - m[1][0] * n.c5 - m[1][3] * n.c1,
+                    m[0][0] * n.c5 - m[0][2] * n.c2 + m[0][3] * n.c1,
+                    m[3][2] * n.s2 - m[3][0] * n.s5 - m[3][3] * n.s1,
+                    m[2][0] * n.s5 - m[2][2] * n.s2 + m[2][3] * n.s1,
+                },
+                {
+                    m[1][0] * n.c4 - m[1][1] * n.c2 + m[1][3] * n.c0,
+                    m[0][1] * n.c2 - m[0][0] * n.c4 - m[0][3] * n.c0,
+                    m[3][0] * n.s4 - m[3][1] * n.s2 + m[3][3] * n.s0,
+                    m[2][1] * n.s2 - m[2][0] * n.s4 - m[2][3] * n.s0,
+                },
+                {
+                    m[1][1] * n.c1 - m[1][0] * n.c3 - m[1][2] * n.c0,
+                    m[0][0] * n.c3 - m[0][1] * n.c1 + m[0][2] * n.c0,
+                    m[3][1] * n.s1 - m[3][0] * n.s3 - m[3][2] * n.s0,
+                    m[2][0] * n.s3 - m[2][1] * n.s1 + m[2][2] * n.s0,
+                }) * rdet;
+        }
+
+        // m is the affine transformation v*l + t (where v is a row vector)
+        // with the inverse v*li - t*li.
+        template<typename T>
+        inline constexpr mat<T, 3, 4> inverse_affine_m(
+            const mat<T, 3, 4>& m, const mat<T, 3, 3>& li) noexcept
+        {
+            const auto t = -(vec<T, 3>(m[0][3], m[1][3], m[2][3]) * li);
+            return {
+                { li[0], t[0] },
+                { li[1], t[1] },
+                { li[2], t[2] },
+            };
+        }
+
+        template<typename T>
+        inline constexpr mat<T, 4, 4> inverse_affine_m(
+            const mat<T, 4, 4>& m, const mat<T, 3, 3>& li) noexcept
+        {
+            const auto t = -(vec<T, 3>(m[0][3], m[1][3], m[2][3]) * li);
+            return {
+                { li[0], t[0] },
+                { li[1], t[1] },
+                { li[2], t[2] },
+                { T(0), T(0), T(0), T(1) },
+            };
+        }
+
+        // m is the affine transformation l*v + t (where v is a column vector)
+        // with the inverse li*v - li*t.
+        template<typename T>
+        inline constexpr mat<T, 4, 3> inverse_affine_m(
+            const mat<T, 4, 3>& m, const mat<T, 3, 3>& li) noexcept
+        {
+            return { li[0], li[1], li[2], -(li * m[3]) };
+        }
+
+        // The shapes without an SSE path use the generic inverse
+        template<typename T, int N>
+        inline mat<T, N, N> simd_inverse_m(const mat<T, N, N>& m) noexcept
+        {
+            return tue::detail_::inverse_m(m);
+        }
+
+#ifdef TUE_SSE
+        // Each __m128 below holds a 2x2 block (a, b, c, d) in row-major
+        // order. See "Fast 4x4 Matrix Inverse with SSE SIMD, Explained"
+        // by Eric Zhang for the derivation of the block method.
+
+        // a * b
+        inline __m128 mat2_mul_sse(__m128 a, __m128 b) noexcept
+        {
+            return _mm_add_ps(
+                _mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                _mm_mul_ps(
+                    _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                    _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        // adjugate(a) * b
+        inline __m128 mat2_adj_mul_sse(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(
+                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                _mm_mul_ps(
+                    _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)),
+                    _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        // a * adjugate(b)
+        inline __m128 mat2_mul_adj_sse(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(
+                _mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                _mm_mul_ps(
+                    _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                    _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        inline mat<float, 4, 4> simd_inverse_m(
+            const mat<float, 4, 4>& m) noexcept
+        {
+            const auto r0 = _mm_loadu_ps(m[0].data());
+            const auto r1 = _mm_loadu_ps(m[1].data());
+            const auto r2 = _mm_loadu_ps(m[2].data());
+            const auto r3 = _mm_loadu_ps(m[3].data());
+
+            // m = | a b |
+            //     | c d |
+            const auto a = _mm_movelh_ps(r0, r1);
+            const auto b = _mm_movehl_ps(r1, r0);
+            const auto c = _mm_movelh_ps(r2, r3);
+            const auto d = _mm_movehl_ps(r3, r2);
+
+            // (det(a), det(b), det(c), det(d))
+            const auto dets = _mm_sub_ps(
+                _mm_mul_ps(
+                    _mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+                _mm_mul_ps(
+                    _mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)),
+                    _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+            const auto det_a = _mm_shuffle_ps(dets, dets, 0x00);
+            const auto det_b = _mm_shuffle_ps(dets, dets, 0x55);
+            const auto det_c = _mm_shuffle_ps(dets, dets, 0xAA);
+            const auto det_d = _mm_shuffle_ps(dets, dets, 0xFF);
+
+            const auto d_c = mat2_adj_mul_sse(d, c);
+            const auto a_b = mat2_adj_mul_sse(a, b);
+
+            // The adjugates of the blocks of the inverse (times det(m))
+            const auto x = _mm_sub_ps(
+                _mm_mul_ps(det_d, a), mat2_mul_sse(b, d_c));
+            const auto w = _mm_sub_ps(
+                _mm_mul_ps(det_a, d), mat2_mul_sse(c, a_b));
+            const auto y = _mm_sub_ps(
+                _mm_mul_ps(det_b, c), mat2_mul_adj_sse(d, a_b));
+            const auto z = _mm_sub_ps(
+                _mm_mul_ps(det_c, b), mat2_mul_adj_sse(a, d_c));
+
+            // det(m) = det(a)*det(d) + det(b)*det(c) - trace(a_b * d_c)
+            auto tr = _mm_mul_ps(
+                a_b, _mm_shuffle_ps(d_c, d_c, _MM_SHUFFLE(3, 1, 2, 0)));
+            tr = _mm_add_ps(tr, _mm_movehl_ps(tr, tr));
+            tr = _mm_add_ss(tr, _mm_shuffle_ps(tr, tr, 0x01));
+            tr = _mm_shuffle_ps(tr, tr, 0x00);
+            const auto det = _mm_sub_ps(_mm_add_ps(
+                _mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c)), tr);
+
+            // Applying the adjugates flips the signs of the off-diagonals
+            const auto rdet = _mm_div_ps(
+                _mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+            const auto xr = _mm_mul_ps(x, rdet);
+            const auto yr = _mm_mul_ps(y, rdet);
+            const auto zr = _mm_mul_ps(z, rdet);
+            const auto wr = _mm_mul_ps(w, rdet);
+
+            mat<float, 4, 4> result;
+            _mm_storeu_ps(result[0].data(),
+                _mm_shuffle_ps(xr, yr, _MM_SHUFFLE(1, 3, 1, 3)));
+            _mm_storeu_ps(result[1].data(),
+                _mm_shuffle_ps(xr, yr, _MM_SHUFFLE(0, 2, 0, 2)));
+            _mm_storeu_ps(result[2].data(),
+                _mm_shuffle_ps(zr, wr, _MM_SHUFFLE(1, 3, 1, 3)));
+            _mm_storeu_ps(result[3].data(),
+                _mm_shuffle_ps(zr, wr, _MM_SHUFFLE(0, 2, 0, 2)));
+            return result;
+        }
+#endif
+    }
+}
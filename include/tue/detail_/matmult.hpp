@@ -8,9 +8,11 @@
 
 #pragma once
 
+#include <type_traits>
 #include <utility>
 
 #include "../mat.hpp"
+#include "../simd.hpp"
 #include "../vec.hpp"
 
 namespace tue
@@ -116,6 +118,121 @@ namespace tue
             };
         }
 
+        // Whether or not matrix products with T components and 3 or 4 rows
+        // should treat each column as a simd<T, 4>. Only true when
+        // simd<T, 4> is backed by SSE registers.
+        template<typename T>
+        struct is_matmult_accelerated
+        :
+            public std::integral_constant<bool, false>
+        {
+            using std::integral_constant<bool, false>::integral_constant;
+        };
+
+#ifdef TUE_SSE
+        template<>
+        struct is_matmult_accelerated<float>
+        :
+            public std::integral_constant<bool, true>
+        {
+            using std::integral_constant<bool, true>::integral_constant;
+        };
+#endif
+
+#ifdef TUE_SSE2
+        template<>
+        struct is_matmult_accelerated<double>
+        :
+            public std::integral_constant<bool, true>
+        {
+            using std::integral_constant<bool, true>::integral_constant;
+        };
+#endif
+
+        template<typename T>
+        inline simd<T, 4> matmult_load_column(const vec<T, 3>& v) noexcept
+        {
+            return simd<T, 4>(v[0], v[1], v[2], T(0));
+        }
+
+        template<typename T>
+        inline simd<T, 4> matmult_load_column(const vec<T, 4>& v) noexcept
+        {
+            return simd<T, 4>::loadu(v.data());
+        }
+
+        template<typename T>
+        inline void matmult_store_column(
+            const simd<T, 4>& s, vec<T, 3>& v) noexcept
+        {
+            v = vec<T, 3>(s.data()[0], s.data()[1], s.data()[2]);
+        }
+
+        template<typename T>
+        inline void matmult_store_column(
+            const simd<T, 4>& s, vec<T, 4>& v) noexcept
+        {
+            s.storeu(v.data());
+        }
+
+        // Computes sum(lhs[k] * rhs[k]) with each column of lhs as a
+        // simd<T, 4> and each rhs[k] broadcast to all four lanes.
+        template<typename T, int N>
+        inline simd<T, 4> matmult_simd_column(
+            const simd<T, 4> (&columns)[N], const vec<T, N>& rhs) noexcept
+        {
+            auto result = columns[0] * simd<T, 4>(rhs[0]);
+            for (int k = 1; k < N; ++k)
+            {
+                result += columns[k] * simd<T, 4>(rhs[k]);
+            }
+
+            return result;
+        }
+
+        template<typename T, int N, int R>
+        inline void matmult_load_columns(
+            const mat<T, N, R>& m, simd<T, 4> (&columns)[N]) noexcept
+        {
+            for (int k = 0; k < N; ++k)
+            {
+                columns[k] = tue::detail_::matmult_load_column(m[k]);
+            }
+        }
+
+        template<typename T, int C, int N, int R>
+        inline mat<T, C, R> matmult_simd_mm(
+            const mat<T, N, R>& lhs, const mat<T, C, N>& rhs) noexcept
+        {
+            simd<T, 4> columns[N];
+            tue::detail_::matmult_load_columns(lhs, columns);
+
+            mat<T, C, R> result;
+            for (int i = 0; i < C; ++i)
+            {
+                tue::detail_::matmult_store_column(
+                    tue::detail_::matmult_simd_column(columns, rhs[i]),
+                    result[i]);
+            }
+
+            return result;
+        }
+
+        template<typename T, int N, int R>
+        inline vec<T, R> matmult_simd_mv(
+            const mat<T, N, R>& lhs, const vec<T, N>& rhs) noexcept
+        {
+            simd<T, 4> columns[N];
+            tue::detail_::matmult_load_columns(lhs, columns);
+
+            vec<T, R> result;
+            tue::detail_::matmult_store_column(
+                tue::detail_::matmult_simd_column(columns, rhs),
+                result);
+
+            return result;
+        }
+
         template<typename T, typename U, int N>
         inline constexpr vec<decltype(std::declval<T>() * std::declval<U>()), 2>
         multiplication_operator_vm(
@@ -226,5 +343,86 @@ namespace tue
                 tue::detail_::matmult_column_mm(lhs, rhs, 3),
             };
         }
+
+        // Same-type products with 3 or 4 rows use the simd columns when
+        // they're backed by SSE registers and the generic templates
+        // otherwise
+        template<typename T, int N, int R>
+        inline std::enable_if_t<
+            is_matmult_accelerated<T>::value && (R == 3 || R == 4),
+            vec<T, R>>
+        simd_mult_mv(const mat<T, N, R>& lhs, const vec<T, N>& rhs) noexcept
+        {
+            return tue::detail_::matmult_simd_mv(lhs, rhs);
+        }
+
+        template<typename T, int N, int R>
+        inline std::enable_if_t<
+            !(is_matmult_accelerated<T>::value && (R == 3 || R == 4)),
+            vec<T, R>>
+        simd_mult_mv(const mat<T, N, R>& lhs, const vec<T, N>& rhs) noexcept
+        {
+            return tue::detail_::multiplication_operator_mv(lhs, rhs);
+        }
+
+        template<typename T, int C, int N, int R>
+        inline std::enable_if_t<
+            is_matmult_accelerated<T>::value && (R == 3 || R == 4),
+            mat<T, C, R>>
+        simd_mult_mm(const mat<T, N, R>& lhs, const mat<T, C, N>& rhs) noexcept
+        {
+            return tue::detail_::matmult_simd_mm(lhs, rhs);
+        }
+
+        template<typename T, int C, int N, int R>
+        inline std::enable_if_t<
+            !(is_matmult_accelerated<T>::value && (R == 3 || R == 4)),
+            mat<T, C, R>>
+        simd_mult_mm(const mat<T, N, R>& lhs, const mat<T, C, N>& rhs) noexcept
+        {
+            return tue::detail_::multiplication_operator_mm(lhs, rhs);
+        }
+
+        // A column of lhs * rhs where the missing last columns of both are
+        // [0, 0, 0, 1]
+        template<typename T>
+        inline constexpr vec<T, 4> affine_mult_column(
+            const mat<T, 3, 4>& lhs, const vec<T, 4>& rhs) noexcept
+        {
+            return tue::detail_::multiplication_operator_mv(lhs, rhs.xyz())
+                + vec<T, 4>(T(0), T(0), T(0), rhs[3]);
+        }
+
+        template<typename T>
+        inline constexpr mat<T, 3, 4> affine_mult_m(
+            const mat<T, 3, 4>& lhs, const mat<T, 3, 4>& rhs) noexcept
+        {
+            return {
+                tue::detail_::affine_mult_column(lhs, rhs[0]),
+                tue::detail_::affine_mult_column(lhs, rhs[1]),
+                tue::detail_::affine_mult_column(lhs, rhs[2]),
+            };
+        }
+
+        // lhs * vec4(v, 0) without multiplying by the padding
+        template<typename T>
+        inline constexpr vec<T, 3> affine_mult_vector(
+            const mat<T, 4, 3>& lhs, const vec<T, 3>& v) noexcept
+        {
+            return lhs[0]*v[0] + lhs[1]*v[1] + lhs[2]*v[2];
+        }
+
+        // The missing last rows of both lhs and rhs are [0, 0, 0, 1]
+        template<typename T>
+        inline constexpr mat<T, 4, 3> affine_mult_m(
+            const mat<T, 4, 3>& lhs, const mat<T, 4, 3>& rhs) noexcept
+        {
+            return {
+                tue::detail_::affine_mult_vector(lhs, rhs[0]),
+                tue::detail_::affine_mult_vector(lhs, rhs[1]),
+                tue::detail_::affine_mult_vector(lhs, rhs[2]),
+                tue::detail_::affine_mult_vector(lhs, rhs[3]) + lhs[3],
+            };
+        }
     }
 }
@@ -0,0 +1,217 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include "../mat.hpp"
+#include "../simd.hpp"
+#include "../vec.hpp"
+
+#ifdef TUE_SSE
+#include <xmmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
+// Packing N matrices into one mat of simd<T, N>'s and unpacking them again
+// are both transposes: component (c, r) of matrix i becomes lane i of
+// component (c, r), so each column of N matrices is an N-by-R transpose.
+
+namespace tue
+{
+    namespace detail_
+    {
+        template<typename T, int N, int C, int R>
+        inline void pack_mats_m(
+            const mat<T, C, R>* ms, mat<simd<T, N>, C, R>& result) noexcept
+        {
+            for (int c = 0; c < C; ++c)
+            {
+                for (int r = 0; r < R; ++r)
+                {
+                    for (int i = 0; i < N; ++i)
+                    {
+                        result[c][r].data()[i] = ms[i][c][r];
+                    }
+                }
+            }
+        }
+
+        template<typename T, int N, int C, int R>
+        inline void unpack_mats_m(
+            const mat<simd<T, N>, C, R>& m, mat<T, C, R>* ms) noexcept
+        {
+            for (int c = 0; c < C; ++c)
+            {
+                for (int r = 0; r < R; ++r)
+                {
+                    for (int i = 0; i < N; ++i)
+                    {
+                        ms[i][c][r] = m[c][r].data()[i];
+                    }
+                }
+            }
+        }
+
+        // The shapes without a simd shuffle use the generic transpose
+        template<typename T, int C, int R>
+        inline mat<T, R, C> simd_transpose_m(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::transpose_m(m);
+        }
+
+#ifdef TUE_SSE
+        // Transposes the 4x4 block whose rows start at src[0..3] into the
+        // rows starting at dst[0..3]. The rows can overlap.
+        inline void transpose4_sse(
+            const float* const* src, float* const* dst) noexcept
+        {
+            auto r0 = _mm_loadu_ps(src[0]);
+            auto r1 = _mm_loadu_ps(src[1]);
+            auto r2 = _mm_loadu_ps(src[2]);
+            auto r3 = _mm_loadu_ps(src[3]);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(dst[0], r0);
+            _mm_storeu_ps(dst[1], r1);
+            _mm_storeu_ps(dst[2], r2);
+            _mm_storeu_ps(dst[3], r3);
+        }
+
+        inline mat<float, 4, 4> simd_transpose_m(
+            const mat<float, 4, 4>& m) noexcept
+        {
+            mat<float, 4, 4> result;
+            const float* const src[4] = {
+                m[0].data(), m[1].data(), m[2].data(), m[3].data(),
+            };
+            float* const dst[4] = {
+                result[0].data(), result[1].data(),
+                result[2].data(), result[3].data(),
+            };
+            tue::detail_::transpose4_sse(src, dst);
+            return result;
+        }
+
+        inline void pack_mats_m(
+            const mat<float, 4, 4>* ms,
+            mat<simd<float, 4>, 4, 4>& result) noexcept
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                const float* const src[4] = {
+                    ms[0][c].data(), ms[1][c].data(),
+                    ms[2][c].data(), ms[3][c].data(),
+                };
+                float* const dst[4] = {
+                    result[c][0].data(), result[c][1].data(),
+                    result[c][2].data(), result[c][3].data(),
+                };
+                tue::detail_::transpose4_sse(src, dst);
+            }
+        }
+
+        inline void unpack_mats_m(
+            const mat<simd<float, 4>, 4, 4>& m,
+            mat<float, 4, 4>* ms) noexcept
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                const float* const src[4] = {
+                    m[c][0].data(), m[c][1].data(),
+                    m[c][2].data(), m[c][3].data(),
+                };
+                float* const dst[4] = {
+                    ms[0][c].data(), ms[1][c].data(),
+                    ms[2][c].data(), ms[3][c].data(),
+                };
+                tue::detail_::transpose4_sse(src, dst);
+            }
+        }
+#endif
+
+#ifdef TUE_AVX
+        // Transposes the 8x8 block whose rows start at src[0..7] into the
+        // rows starting at dst[0..7]. The rows can overlap.
+        inline void transpose8_avx(
+            const float* const* src, float* const* dst) noexcept
+        {
+            __m256 r[8];
+            for (int i = 0; i < 8; ++i)
+            {
+                r[i] = _mm256_loadu_ps(src[i]);
+            }
+
+            __m256 t[8];
+            for (int i = 0; i < 8; i += 2)
+            {
+                t[i] = _mm256_unpacklo_ps(r[i], r[i+1]);
+                t[i+1] = _mm256_unpackhi_ps(r[i], r[i+1]);
+            }
+
+            for (int i = 0; i < 8; i += 4)
+            {
+                r[i] = _mm256_shuffle_ps(
+                    t[i], t[i+2], _MM_SHUFFLE(1, 0, 1, 0));
+                r[i+1] = _mm256_shuffle_ps(
+                    t[i], t[i+2], _MM_SHUFFLE(3, 2, 3, 2));
+                r[i+2] = _mm256_shuffle_ps(
+                    t[i+1], t[i+3], _MM_SHUFFLE(1, 0, 1, 0));
+                r[i+3] = _mm256_shuffle_ps(
+                    t[i+1], t[i+3], _MM_SHUFFLE(3, 2, 3, 2));
+            }
+
+            for (int i = 0; i < 4; ++i)
+            {
+                _mm256_storeu_ps(
+                    dst[i], _mm256_permute2f128_ps(r[i], r[i+4], 0x20));
+                _mm256_storeu_ps(
+                    dst[i+4], _mm256_permute2f128_ps(r[i], r[i+4], 0x31));
+            }
+        }
+
+        // Each 8-float row is two adjacent columns of one matrix
+        inline void pack_mats_m(
+            const mat<float, 4, 4>* ms,
+            mat<simd<float, 8>, 4, 4>& result) noexcept
+        {
+            for (int c = 0; c < 4; c += 2)
+            {
+                const float* src[8];
+                float* dst[8];
+                for (int i = 0; i < 8; ++i)
+                {
+                    src[i] = ms[i].data() + 4*c;
+                    dst[i] = result[c + i/4][i%4].data();
+                }
+
+                tue::detail_::transpose8_avx(src, dst);
+            }
+        }
+
+        inline void unpack_mats_m(
+            const mat<simd<float, 8>, 4, 4>& m,
+            mat<float, 4, 4>* ms) noexcept
+        {
+            for (int c = 0; c < 4; c += 2)
+            {
+                const float* src[8];
+                float* dst[8];
+                for (int i = 0; i < 8; ++i)
+                {
+                    src[i] = m[c + i/4][i%4].data();
+                    dst[i] = ms[i].data() + 4*c;
+                }
+
+                tue::detail_::transpose8_avx(src, dst);
+            }
+        }
+#endif
+    }
+}
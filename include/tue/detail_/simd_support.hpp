@@ -32,4 +32,30 @@
 #define TUE_SSE2
 #endif
 
+#if defined(__AVX__)
+/*!
+ * \brief Defined if the current compiler configuration supports AVX
+ *        intrinsics.
+ */
+#define TUE_AVX
+#endif
+
+#if defined(__F16C__) \
+    || (defined(_MSC_VER) && defined(__AVX2__))
+/*!
+ * \brief Defined if the current compiler configuration supports F16C
+ *        (half-precision conversion) intrinsics.
+ */
+#define TUE_F16C
+#endif
+
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+/*!
+ * \brief Defined if the current compiler configuration supports AVX-512 BF16
+ *        (bfloat16 conversion) intrinsics on 128-, 256-, and 512-bit
+ *        vectors.
+ */
+#define TUE_AVX512BF16
+#endif
+
 /*!@}*/
@@ -0,0 +1,517 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "mat.hpp"
+#include "math.hpp"
+#include "quat.hpp"
+#include "simd.hpp"
+#include "transform.hpp"
+#include "vec.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // The vector part of 2 * d * conjugate(r)
+        template<typename T>
+        inline constexpr vec3<T> dual_quat_translation(
+            const quat<T>& r, const quat<T>& d) noexcept
+        {
+            return (r.s()*d.v() - d.s()*r.v()
+                + tue::math::cross(d.v(), r.v())) * T(2);
+        }
+
+        template<typename T>
+        inline void rigid_parts_m(
+            const mat<T, 4, 3>& m, quat<T>& r, vec3<T>& t) noexcept
+        {
+            r = tue::detail_::rotation_quat_m(mat<T, 3, 3>(m));
+            t = m[3];
+        }
+
+        template<typename T, int C>
+        inline void rigid_parts_m(
+            const mat<T, C, 4>& m, quat<T>& r, vec3<T>& t) noexcept
+        {
+            r = tue::detail_::rotation_quat_m(
+                tue::math::transpose(mat<T, 3, 3>(m)));
+            t = { m[0][3], m[1][3], m[2][3] };
+        }
+
+        template<typename T>
+        inline void rigid_mat_m(
+            const quat<T>& r, const vec3<T>& t, mat<T, 4, 3>& m) noexcept
+        {
+            m = tue::transform::rotation_mat<T, 4, 3>(r);
+            m[3] = t;
+        }
+
+        template<typename T, int C>
+        inline void rigid_mat_m(
+            const quat<T>& r, const vec3<T>& t, mat<T, C, 4>& m) noexcept
+        {
+            m = tue::transform::rotation_mat<T, C, 4>(
+                tue::math::conjugate(r));
+            m[0][3] = t[0];
+            m[1][3] = t[1];
+            m[2][3] = t[2];
+        }
+    }
+
+    /*!
+     * \defgroup  dual_quat_hpp <tue/dual_quat.hpp>
+     *
+     * \brief     The `dual_quat` class template and its associated functions.
+     *
+     * @{
+     */
+
+    /*!
+     * \brief     A dual quaternion.
+     * \details   A unit `dual_quat` represents a rigid transformation: a
+     *            rotation followed by a translation. Unlike matrices, they
+     *            can be blended without introducing shear or scale, which
+     *            makes them a good fit for skinning.
+     *
+     *            The real part is the rotation `quat` itself, so `p * dq`
+     *            gives the same result as `p * dq.real() + t` where `t` is
+     *            the translation. The dual part is half of
+     *            `quat(t, 0) * dq.real()`.
+     *
+     *            `dual_quat` has the same size and alignment requirements as
+     *            `T[8]`.
+     *
+     * \tparam T  The component type. `is_vec_component<T>::value` must be
+     *            `true`.
+     */
+    template<typename T>
+    class dual_quat;
+
+    /*!
+     * \brief  A dual quaternion with `float` components.
+     */
+    using fdual_quat = dual_quat<float>;
+
+    /*!
+     * \brief  A dual quaternion with `double` components.
+     */
+    using ddual_quat = dual_quat<double>;
+
+    /**/
+    template<typename T>
+    class dual_quat
+    {
+        quat<T> real_;
+
+        quat<T> dual_;
+
+    public:
+        /*!
+         * \brief  This `dual_quat` type's component type.
+         */
+        using component_type = T;
+
+        /*!
+         * \name Constructors, Conversions, and Factory Functions
+         * @{
+         */
+        /*!
+         * \brief  Default constructs each component.
+         */
+        dual_quat() noexcept = default;
+
+        /*!
+         * \brief       Constructs a `dual_quat` from its two parts.
+         *
+         * \param real  The real part.
+         * \param dual  The dual part.
+         */
+        constexpr dual_quat(const quat<T>& real, const quat<T>& dual) noexcept
+        :
+            real_(real),
+            dual_(dual)
+        {
+        }
+
+        /*!
+         * \brief     Explicitly casts another `dual_quat` to a new component
+         *            type.
+         *
+         * \tparam U  The component type of `dq`.
+         *
+         * \param dq  The `dual_quat` to cast from.
+         */
+        template<typename U>
+        explicit constexpr dual_quat(const dual_quat<U>& dq) noexcept
+        :
+            real_(dq.real()),
+            dual_(dq.dual())
+        {
+        }
+
+        /*!
+         * \brief   Returns a `dual_quat` representing no transformation.
+         *
+         * \return  A `dual_quat` with the real part set to
+         *          `quat<T>::identity()` and the dual part set to zero.
+         */
+        static constexpr dual_quat<T> identity() noexcept
+        {
+            return {
+                quat<T>::identity(),
+                { T(0), T(0), T(0), T(0) },
+            };
+        }
+
+        /*!@}*/
+        /*!
+         * \brief   Returns a copy of this `dual_quat`'s real part.
+         *
+         * \return  A copy of this `dual_quat`'s real part.
+         */
+        constexpr quat<T> real() const noexcept
+        {
+            return this->real_;
+        }
+
+        /*!
+         * \brief   Returns a copy of this `dual_quat`'s dual part.
+         *
+         * \return  A copy of this `dual_quat`'s dual part.
+         */
+        constexpr quat<T> dual() const noexcept
+        {
+            return this->dual_;
+        }
+
+        /*!
+         * \brief       Sets this `dual_quat`'s real part.
+         *
+         * \param real  The new value for the real part.
+         */
+        void set_real(const quat<T>& real) noexcept
+        {
+            this->real_ = real;
+        }
+
+        /*!
+         * \brief       Sets this `dual_quat`'s dual part.
+         *
+         * \param dual  The new value for the dual part.
+         */
+        void set_dual(const quat<T>& dual) noexcept
+        {
+            this->dual_ = dual;
+        }
+
+        /*!
+         * \brief     Transforms this `dual_quat` by `dq`.
+         *
+         * \tparam U  The component type of `dq`.
+         *
+         * \param dq  A rigid transformation `dual_quat`.
+         *
+         * \return    A reference to this `dual_quat`.
+         */
+        template<typename U>
+        dual_quat<T>& operator*=(const dual_quat<U>& dq) noexcept
+        {
+            return (*this) = (*this) * dq;
+        }
+    };
+
+    /*!
+     * \brief      Computes the composition of two rigid transformations.
+     * \details    The result transforms points by `lhs` first and then by
+     *             `rhs`, i.e., `p * (lhs * rhs)` is `p * lhs * rhs`.
+     *
+     * \tparam T   The component type of `lhs`.
+     * \tparam U   The component type of `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     The composition of `lhs` and `rhs`.
+     */
+    template<typename T, typename U>
+    inline constexpr
+        dual_quat<decltype(std::declval<T>() * std::declval<U>())>
+    operator*(const dual_quat<T>& lhs, const dual_quat<U>& rhs) noexcept
+    {
+        using V = decltype(std::declval<T>() * std::declval<U>());
+        return {
+            rhs.real() * lhs.real(),
+            quat<V>((rhs.dual() * lhs.real()).xyzw()
+                + (rhs.real() * lhs.dual()).xyzw()),
+        };
+    }
+
+    /*!
+     * \brief      Computes a copy of the point `lhs` transformed by `rhs`.
+     *
+     * \tparam T   The component type of `lhs`.
+     * \tparam U   The component type of `rhs`.
+     *
+     * \param lhs  A point.
+     * \param rhs  A rigid transformation `dual_quat`. Must be normalized.
+     *
+     * \return     A copy of `lhs` rotated and then translated by `rhs`.
+     */
+    template<typename T, typename U>
+    inline constexpr vec3<decltype(std::declval<T>() * std::declval<U>())>
+    operator*(const vec3<T>& lhs, const dual_quat<U>& rhs) noexcept
+    {
+        return tue::math::rotate(lhs, rhs.real())
+            + tue::detail_::dual_quat_translation(rhs.real(), rhs.dual());
+    }
+
+    /*!
+     * \brief      Determines whether or not two `dual_quat`'s compare equal.
+     *
+     * \tparam T   The component type of `lhs`.
+     * \tparam U   The component type of `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if both pairs of corresponding parts compare equal
+     *             and `false` otherwise.
+     */
+    template<typename T, typename U>
+    inline constexpr bool
+    operator==(const dual_quat<T>& lhs, const dual_quat<U>& rhs) noexcept
+    {
+        return lhs.real() == rhs.real()
+            && lhs.dual() == rhs.dual();
+    }
+
+    /*!
+     * \brief      Determines whether or not two `dual_quat`'s compare not
+     *             equal.
+     *
+     * \tparam T   The component type of `lhs`.
+     * \tparam U   The component type of `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if at least one of the pairs of corresponding parts
+     *             compares not equal and `false` otherwise.
+     */
+    template<typename T, typename U>
+    inline constexpr bool
+    operator!=(const dual_quat<T>& lhs, const dual_quat<U>& rhs) noexcept
+    {
+        return lhs.real() != rhs.real()
+            || lhs.dual() != rhs.dual();
+    }
+
+    /*!@}*/
+    namespace math
+    {
+        /*!
+         * \addtogroup  dual_quat_hpp
+         * @{
+         */
+
+        /*!
+         * \brief     Computes a normalized copy of `dq`.
+         * \details   Both parts are divided by the length of the real part.
+         *
+         * \tparam T  The component type of `dq`.
+         *
+         * \param dq  A `dual_quat`.
+         *
+         * \return    A normalized copy of `dq`.
+         */
+        template<typename T>
+        inline dual_quat<T> normalize(const dual_quat<T>& dq) noexcept
+        {
+            const auto r = dq.real();
+            const auto rlength = T(1.0f)
+                / tue::math::sqrt(tue::detail_::quat_dot(r, r));
+            return {
+                quat<T>(r.xyzw() * rlength),
+                quat<T>(dq.dual().xyzw() * rlength),
+            };
+        }
+
+        /*!
+         * \brief          Blends rigid transformations with dual quaternion
+         *                 linear blending (DLB).
+         * \details        Each `dual_quat` whose real part is on the opposite
+         *                 hemisphere from the first one's is negated first so
+         *                 every blend takes the shorter path. The weighted sum
+         *                 is then normalized.
+         *
+         *                 This function is branch-free, so it works
+         *                 component-wise on `dual_quat`'s of SIMD types
+         *                 (e.g., to blend the bones of eight vertices at
+         *                 once).
+         *
+         * \tparam T       The component type.
+         *
+         * \param dqs      A pointer to the unit `dual_quat`'s to blend.
+         * \param weights  A pointer to the weight of each `dual_quat`.
+         * \param count    The number of `dual_quat`'s to blend. Must be at
+         *                 least 1.
+         *
+         * \return         The blended unit `dual_quat`.
+         */
+        template<typename T>
+        inline dual_quat<T> blend(
+            const dual_quat<T>* dqs, const T* weights,
+            std::size_t count) noexcept
+        {
+            const auto pivot = dqs[0].real();
+            auto real = dqs[0].real().xyzw() * weights[0];
+            auto dual = dqs[0].dual().xyzw() * weights[0];
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                const auto r = dqs[i].real();
+                const auto w = tue::math::select(
+                    tue::math::less(
+                        tue::detail_::quat_dot(pivot, r), T(0.0f)),
+                    -weights[i], weights[i]);
+                real += r.xyzw() * w;
+                dual += dqs[i].dual().xyzw() * w;
+            }
+
+            return tue::math::normalize(
+                dual_quat<T>(quat<T>(real), quat<T>(dual)));
+        }
+
+        /*!@}*/
+    }
+
+    namespace transform
+    {
+        /*!
+         * \addtogroup  dual_quat_hpp
+         * @{
+         */
+
+        /*!
+         * \brief              Computes the `dual_quat` that rotates by
+         *                     `rotation` and then translates by
+         *                     `translation`.
+         *
+         * \tparam T           The component type.
+         *
+         * \param rotation     The rotation quaternion. Must be normalized.
+         * \param translation  The translation.
+         *
+         * \return             The rigid transformation `dual_quat`.
+         */
+        template<typename T>
+        inline constexpr dual_quat<T> rigid_dual_quat(
+            const quat<T>& rotation, const vec3<T>& translation) noexcept
+        {
+            return {
+                rotation,
+                quat<T>((quat<T>(translation, T(0)) * rotation).xyzw()
+                    * T(0.5f)),
+            };
+        }
+
+        /*!
+         * \brief     Computes the `dual_quat` for a rigid transformation
+         *            matrix.
+         * \details   `p * rigid_dual_quat(m)` gives the same result as
+         *            `transform_point(m, p)`. `m` must be a rotation followed
+         *            by a translation (e.g., as returned by `rigid_mat()`).
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`. Either `C` or `R` must be 4 and
+         *            the other must be 3 or 4.
+         *
+         * \param m   The rigid transformation matrix.
+         *
+         * \return    The rigid transformation `dual_quat`.
+         */
+        template<typename T, int C, int R>
+        inline std::enable_if_t<
+            (C == 3 && R == 4) || (C == 4 && R == 3) || (C == 4 && R == 4),
+            dual_quat<T>>
+        rigid_dual_quat(const mat<T, C, R>& m) noexcept
+        {
+            quat<T> r;
+            vec3<T> t;
+            tue::detail_::rigid_parts_m(m, r, t);
+            return tue::transform::rigid_dual_quat(r, t);
+        }
+
+        /*!
+         * \brief     Computes the rotation quaternion of a `dual_quat`.
+         *
+         * \tparam T  The component type of `dq`.
+         *
+         * \param dq  A rigid transformation `dual_quat`. Must be normalized.
+         *
+         * \return    The rotation quaternion.
+         */
+        template<typename T>
+        inline constexpr quat<T> rotation_quat(const dual_quat<T>& dq) noexcept
+        {
+            return dq.real();
+        }
+
+        /*!
+         * \brief     Computes the translation of a `dual_quat`.
+         *
+         * \tparam T  The component type of `dq`.
+         *
+         * \param dq  A rigid transformation `dual_quat`. Must be normalized.
+         *
+         * \return    The translation applied after the rotation.
+         */
+        template<typename T>
+        inline constexpr vec3<T> translation_vec(
+            const dual_quat<T>& dq) noexcept
+        {
+            return tue::detail_::dual_quat_translation(dq.real(), dq.dual());
+        }
+
+        /*!
+         * \brief     Computes the rigid transformation matrix of a
+         *            `dual_quat`.
+         * \details   `transform_point(rigid_mat<T, C, R>(dq), p)` gives the
+         *            same result as `p * dq`.
+         *
+         * \tparam T  The component type of `dq`.
+         * \tparam C  The column count of the returned matrix. Defaults to 4.
+         * \tparam R  The row count of the returned matrix. Defaults to 4.
+         *            Either `C` or `R` must be 4 and the other must be 3 or
+         *            4.
+         *
+         * \param dq  A rigid transformation `dual_quat`. Must be normalized.
+         *
+         * \return    The rigid transformation matrix.
+         */
+        template<typename T, int C = 4, int R = 4>
+        inline std::enable_if_t<
+            (C == 3 && R == 4) || (C == 4 && R == 3) || (C == 4 && R == 4),
+            mat<T, C, R>>
+        rigid_mat(const dual_quat<T>& dq) noexcept
+        {
+            mat<T, C, R> m;
+            tue::detail_::rigid_mat_m(
+                dq.real(), tue::transform::translation_vec(dq), m);
+            return m;
+        }
+
+        /*!@}*/
+    }
+}
@@ -0,0 +1,1616 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "detail_/is_sized_bool.hpp"
+#include "math.hpp"
+#include "simd.hpp"
+#include "sized_bool.hpp"
+
+#ifdef TUE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace tue
+{
+    namespace detail_
+    {
+        template<int Bits>
+        using fixed_storage_t = std::conditional_t<
+            (Bits <= 16), std::int16_t, std::int32_t>;
+
+        template<typename S>
+        using fixed_wide_t = std::conditional_t<
+            std::is_same<S, std::int16_t>::value, std::int32_t, std::int64_t>;
+
+        // Signed overflow is undefined, so wrap-around arithmetic is done on
+        // the unsigned equivalents instead.
+        template<typename S>
+        inline constexpr S fixed_add(S a, S b) noexcept
+        {
+            using U = std::make_unsigned_t<S>;
+            return S(U(U(a) + U(b)));
+        }
+
+        template<typename S>
+        inline constexpr S fixed_subtract(S a, S b) noexcept
+        {
+            using U = std::make_unsigned_t<S>;
+            return S(U(U(a) - U(b)));
+        }
+
+        template<int F, typename S>
+        inline constexpr std::enable_if_t<std::is_integral<S>::value, S>
+        fixed_multiply(S a, S b) noexcept
+        {
+            return S((fixed_wide_t<S>(a) * b) >> F);
+        }
+
+        template<int F, typename S>
+        inline constexpr std::enable_if_t<std::is_integral<S>::value, S>
+        fixed_divide(S a, S b) noexcept
+        {
+            return S(fixed_wide_t<S>(a) * (fixed_wide_t<S>(1) << F) / b);
+        }
+
+        template<int F, typename S>
+        inline std::enable_if_t<std::is_integral<S>::value, S>
+        fixed_sqrt(S a) noexcept
+        {
+            if (a <= 0)
+            {
+                return S(0);
+            }
+
+            // Digit-by-digit square root of a * 2^F, rounded down
+            auto x = std::uint64_t(a) << F;
+            std::uint64_t result = 0;
+            std::uint64_t bit = std::uint64_t(1) << 62;
+            while (bit > x)
+            {
+                bit >>= 2;
+            }
+
+            while (bit != 0)
+            {
+                if (x >= result + bit)
+                {
+                    x -= result + bit;
+                    result = (result >> 1) + bit;
+                }
+                else
+                {
+                    result >>= 1;
+                }
+
+                bit >>= 2;
+            }
+
+            return S(result);
+        }
+
+        template<typename S, int F>
+        inline constexpr S fixed_from_double(double x) noexcept
+        {
+            return S(x * double(std::int64_t(1) << F)
+                + (x < 0.0 ? -0.5 : 0.5));
+        }
+    }
+
+    /*!
+     * \defgroup  fixed_hpp <tue/fixed.hpp>
+     *
+     * \brief     The `fixed` class template and its associated operators and
+     *            math functions.
+     * @{
+     */
+
+    /*!
+     * \brief            A signed fixed-point number with `IntBits` integer
+     *                   bits (including the sign bit) and `FracBits`
+     *                   fractional bits, e.g., `fixed<16, 16>` (Q16.16) or
+     *                   `fixed<8, 8>` (Q8.8).
+     * \details          Every operation is defined in terms of integer
+     *                   arithmetic on the binary representation, so results
+     *                   are bit-exact on every platform and for every `simd`
+     *                   width. Addition and subtraction wrap around on
+     *                   overflow. Multiplication rounds toward negative
+     *                   infinity and division toward zero.
+     *
+     *                   A `fixed` can be used as the component type of a
+     *                   `vec`, `mat`, or `quat`, and `simd<fixed<IntBits,
+     *                   FracBits>, N>` is backed by an `int16x8`, `int32x4`,
+     *                   etc. with accelerated multiplication.
+     *
+     * \tparam IntBits   The number of integer bits (including the sign bit).
+     * \tparam FracBits  The number of fractional bits.
+     */
+    template<int IntBits, int FracBits>
+    class fixed
+    {
+        static_assert(IntBits >= 1 && FracBits >= 0
+                && IntBits + FracBits <= 32,
+            "fixed must have between 1 and 32 bits");
+
+    public:
+        /*!
+         * \brief  The underlying integral type: `std::int16_t` if
+         *         `IntBits + FracBits <= 16` and `std::int32_t` otherwise.
+         */
+        using storage_type =
+            tue::detail_::fixed_storage_t<IntBits + FracBits>;
+
+        /*!
+         * \brief  The number of integer bits (including the sign bit).
+         */
+        static constexpr int int_bits = IntBits;
+
+        /*!
+         * \brief  The number of fractional bits.
+         */
+        static constexpr int frac_bits = FracBits;
+
+    private:
+        storage_type bits_;
+
+        struct from_bits_tag {};
+
+        constexpr fixed(storage_type bits, from_bits_tag) noexcept
+        :
+            bits_(bits)
+        {
+        }
+
+    public:
+        /*!
+         * \brief  Default constructs a `fixed` with an indeterminate value.
+         */
+        fixed() noexcept = default;
+
+        /*!
+         * \brief    Constructs a `fixed` with the value of `x`.
+         *
+         * \param x  The value to convert.
+         */
+        explicit constexpr fixed(int x) noexcept
+        :
+            bits_(storage_type(std::int64_t(x) * (std::int64_t(1) << FracBits)))
+        {
+        }
+
+        /*!
+         * \brief    Constructs a `fixed` with the value of `x` rounded to the
+         *           nearest representable value (ties away from zero).
+         * \details  `x` must be in range.
+         *
+         * \param x  The value to convert.
+         */
+        explicit constexpr fixed(float x) noexcept
+        :
+            bits_(tue::detail_::fixed_from_double<storage_type, FracBits>(x))
+        {
+        }
+
+        /*!
+         * \brief    Constructs a `fixed` with the value of `x` rounded to the
+         *           nearest representable value (ties away from zero).
+         * \details  `x` must be in range.
+         *
+         * \param x  The value to convert.
+         */
+        explicit constexpr fixed(double x) noexcept
+        :
+            bits_(tue::detail_::fixed_from_double<storage_type, FracBits>(x))
+        {
+        }
+
+        /*!
+         * \brief       Constructs a `fixed` from its binary representation.
+         *
+         * \param bits  The binary representation.
+         *
+         * \return      The new `fixed`.
+         */
+        static constexpr fixed from_bits(storage_type bits) noexcept
+        {
+            return fixed(bits, from_bits_tag());
+        }
+
+        /*!
+         * \brief   Returns the binary representation of this `fixed`.
+         *
+         * \return  The binary representation of this `fixed`.
+         */
+        constexpr storage_type bits() const noexcept
+        {
+            return bits_;
+        }
+
+        /*!
+         * \brief   Converts this `fixed` to a `float`.
+         *
+         * \return  This `fixed` as a `float`.
+         */
+        explicit constexpr operator float() const noexcept
+        {
+            return float(bits_)
+                * (1.0f / float(std::int64_t(1) << FracBits));
+        }
+
+        /*!
+         * \brief   Converts this `fixed` to a `double`.
+         *
+         * \return  This `fixed` as a `double`.
+         */
+        explicit constexpr operator double() const noexcept
+        {
+            return double(bits_)
+                * (1.0 / double(std::int64_t(1) << FracBits));
+        }
+
+        /*!
+         * \brief   Converts this `fixed` to an `int`, rounding toward
+         *          negative infinity.
+         *
+         * \return  This `fixed` as an `int`.
+         */
+        explicit constexpr operator int() const noexcept
+        {
+            return int(bits_ >> FracBits);
+        }
+
+        /*!
+         * \brief    Adds `x` to this `fixed`.
+         *
+         * \param x  The value to add.
+         *
+         * \return   A reference to this `fixed`.
+         */
+        fixed& operator+=(const fixed& x) noexcept
+        {
+            bits_ = tue::detail_::fixed_add(bits_, x.bits_);
+            return *this;
+        }
+
+        /*!
+         * \brief    Subtracts `x` from this `fixed`.
+         *
+         * \param x  The value to subtract.
+         *
+         * \return   A reference to this `fixed`.
+         */
+        fixed& operator-=(const fixed& x) noexcept
+        {
+            bits_ = tue::detail_::fixed_subtract(bits_, x.bits_);
+            return *this;
+        }
+
+        /*!
+         * \brief    Multiplies this `fixed` by `x`.
+         *
+         * \param x  The value to multiply by.
+         *
+         * \return   A reference to this `fixed`.
+         */
+        fixed& operator*=(const fixed& x) noexcept
+        {
+            bits_ = tue::detail_::fixed_multiply<FracBits>(bits_, x.bits_);
+            return *this;
+        }
+
+        /*!
+         * \brief    Divides this `fixed` by `x`.
+         *
+         * \param x  The value to divide by. Must not be `0`.
+         *
+         * \return   A reference to this `fixed`.
+         */
+        fixed& operator/=(const fixed& x) noexcept
+        {
+            bits_ = tue::detail_::fixed_divide<FracBits>(bits_, x.bits_);
+            return *this;
+        }
+    };
+
+    /*!
+     * \brief  A Q16.16 fixed-point number.
+     */
+    using fixed16_16 = fixed<16, 16>;
+
+    /*!
+     * \brief  A Q8.8 fixed-point number.
+     */
+    using fixed8_8 = fixed<8, 8>;
+
+    /*!
+     * \brief     Returns a copy of `x`.
+     *
+     * \param x   A `fixed`.
+     *
+     * \return    A copy of `x`.
+     */
+    template<int I, int F>
+    inline constexpr fixed<I, F> operator+(const fixed<I, F>& x) noexcept
+    {
+        return x;
+    }
+
+    /*!
+     * \brief     Negates `x`.
+     *
+     * \param x   A `fixed`.
+     *
+     * \return    The negation of `x`.
+     */
+    template<int I, int F>
+    inline constexpr fixed<I, F> operator-(const fixed<I, F>& x) noexcept
+    {
+        using S = typename fixed<I, F>::storage_type;
+        return fixed<I, F>::from_bits(
+            tue::detail_::fixed_subtract(S(0), x.bits()));
+    }
+
+    /*!
+     * \brief      Adds two `fixed`'s (wrapping around on overflow).
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     The sum of `lhs` and `rhs`.
+     */
+    template<int I, int F>
+    inline constexpr fixed<I, F> operator+(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return fixed<I, F>::from_bits(
+            tue::detail_::fixed_add(lhs.bits(), rhs.bits()));
+    }
+
+    /*!
+     * \brief      Subtracts two `fixed`'s (wrapping around on overflow).
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     The difference of `lhs` and `rhs`.
+     */
+    template<int I, int F>
+    inline constexpr fixed<I, F> operator-(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return fixed<I, F>::from_bits(
+            tue::detail_::fixed_subtract(lhs.bits(), rhs.bits()));
+    }
+
+    /*!
+     * \brief      Multiplies two `fixed`'s (rounding toward negative
+     *             infinity).
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     The product of `lhs` and `rhs`.
+     */
+    template<int I, int F>
+    inline constexpr fixed<I, F> operator*(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return fixed<I, F>::from_bits(
+            tue::detail_::fixed_multiply<F>(lhs.bits(), rhs.bits()));
+    }
+
+    /*!
+     * \brief      Divides two `fixed`'s (rounding toward zero).
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand. Must not be `0`.
+     *
+     * \return     The quotient of `lhs` and `rhs`.
+     */
+    template<int I, int F>
+    inline constexpr fixed<I, F> operator/(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return fixed<I, F>::from_bits(
+            tue::detail_::fixed_divide<F>(lhs.bits(), rhs.bits()));
+    }
+
+    /*!
+     * \brief      Determines whether or not two `fixed`'s compare equal.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if `lhs` equals `rhs` and `false` otherwise.
+     */
+    template<int I, int F>
+    inline constexpr bool operator==(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return lhs.bits() == rhs.bits();
+    }
+
+    /*!
+     * \brief      Determines whether or not two `fixed`'s compare not equal.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if `lhs` doesn't equal `rhs` and `false`
+     *             otherwise.
+     */
+    template<int I, int F>
+    inline constexpr bool operator!=(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return lhs.bits() != rhs.bits();
+    }
+
+    /*!
+     * \brief      Determines whether or not `lhs` is less than `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if `lhs` is less than `rhs` and `false` otherwise.
+     */
+    template<int I, int F>
+    inline constexpr bool operator<(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return lhs.bits() < rhs.bits();
+    }
+
+    /*!
+     * \brief      Determines whether or not `lhs` is less than or equal to
+     *             `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if `lhs` is less than or equal to `rhs` and `false`
+     *             otherwise.
+     */
+    template<int I, int F>
+    inline constexpr bool operator<=(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return lhs.bits() <= rhs.bits();
+    }
+
+    /*!
+     * \brief      Determines whether or not `lhs` is greater than `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if `lhs` is greater than `rhs` and `false`
+     *             otherwise.
+     */
+    template<int I, int F>
+    inline constexpr bool operator>(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return lhs.bits() > rhs.bits();
+    }
+
+    /*!
+     * \brief      Determines whether or not `lhs` is greater than or equal
+     *             to `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if `lhs` is greater than or equal to `rhs` and
+     *             `false` otherwise.
+     */
+    template<int I, int F>
+    inline constexpr bool operator>=(
+        const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+    {
+        return lhs.bits() >= rhs.bits();
+    }
+
+    /*!@}*/
+
+    namespace detail_
+    {
+#ifdef TUE_SSE2
+        template<int F>
+        inline __m128i fixed_multiply_epi16(__m128i a, __m128i b) noexcept
+        {
+            // The 32-bit products are split across mullo and mulhi, so
+            // shifting each half and recombining them is the whole shift.
+            const auto lo = _mm_mullo_epi16(a, b);
+            const auto hi = _mm_mulhi_epi16(a, b);
+            return _mm_or_si128(
+                _mm_srli_epi16(lo, F), _mm_slli_epi16(hi, 16 - F));
+        }
+
+        template<int F>
+        inline __m128i fixed_multiply_epi32(__m128i a, __m128i b) noexcept
+        {
+            const auto lo_mask = _mm_set_epi32(0, -1, 0, -1);
+
+            // SSE2 only has an unsigned 32x32->64-bit multiply (on the even
+            // lanes), so correct the high halves of the products for the
+            // signs of the operands: hi -= (a < 0 ? b : 0) + (b < 0 ? a : 0).
+            const auto even = _mm_mul_epu32(a, b);
+            const auto odd = _mm_mul_epu32(
+                _mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            const auto fix = _mm_add_epi32(
+                _mm_and_si128(_mm_srai_epi32(a, 31), b),
+                _mm_and_si128(_mm_srai_epi32(b, 31), a));
+
+            const auto even_signed =
+                _mm_sub_epi64(even, _mm_slli_epi64(fix, 32));
+            const auto odd_signed =
+                _mm_sub_epi64(odd, _mm_andnot_si128(lo_mask, fix));
+
+            return _mm_or_si128(
+                _mm_and_si128(_mm_srli_epi64(even_signed, F), lo_mask),
+                _mm_slli_epi64(_mm_srli_epi64(odd_signed, F), 32));
+        }
+
+        template<int F>
+        inline __m128i fixed_multiply_sse2(
+            __m128i a, __m128i b, std::int16_t) noexcept
+        {
+            return tue::detail_::fixed_multiply_epi16<F>(a, b);
+        }
+
+        template<int F>
+        inline __m128i fixed_multiply_sse2(
+            __m128i a, __m128i b, std::int32_t) noexcept
+        {
+            return tue::detail_::fixed_multiply_epi32<F>(a, b);
+        }
+#endif
+
+        template<typename S, int F, int N>
+        struct fixed_utils
+        {
+            // The number of S's in a 128-bit register
+            static constexpr int native_count = 16 / int(sizeof(S));
+
+            using split_tag = std::integral_constant<int, 1>;
+            using native_tag = std::integral_constant<int, 0>;
+            using scalar_tag = std::integral_constant<int, -1>;
+
+            using tag = std::integral_constant<int,
+                (N > native_count) - (N < native_count)>;
+
+            static simd<S, N> multiply(
+                const simd<S, N>& a, const simd<S, N>& b) noexcept
+            {
+                return multiply(a, b, tag());
+            }
+
+            static simd<S, N> multiply(
+                const simd<S, N>& a, const simd<S, N>& b, split_tag) noexcept
+            {
+                using H = simd<S, N/2>;
+                alignas(simd<S, N>) S lanes[N];
+                alignas(simd<S, N>) S b_lanes[N];
+                a.store(lanes);
+                b.store(b_lanes);
+                fixed_utils<S, F, N/2>::multiply(
+                    H::load(lanes), H::load(b_lanes)).store(lanes);
+                fixed_utils<S, F, N/2>::multiply(
+                    H::load(lanes + N/2), H::load(b_lanes + N/2))
+                    .store(lanes + N/2);
+                return simd<S, N>::load(lanes);
+            }
+
+            static simd<S, N> multiply(
+                const simd<S, N>& a, const simd<S, N>& b, native_tag) noexcept
+            {
+#ifdef TUE_SSE2
+                return tue::detail_::fixed_multiply_sse2<F>(a, b, S());
+#else
+                return multiply(a, b, scalar_tag());
+#endif
+            }
+
+            static simd<S, N> multiply(
+                const simd<S, N>& a, const simd<S, N>& b, scalar_tag) noexcept
+            {
+                alignas(simd<S, N>) S lanes[N];
+                alignas(simd<S, N>) S b_lanes[N];
+                a.store(lanes);
+                b.store(b_lanes);
+                for (int i = 0; i < N; ++i)
+                {
+                    lanes[i] = tue::detail_::fixed_multiply<F>(
+                        lanes[i], b_lanes[i]);
+                }
+                return simd<S, N>::load(lanes);
+            }
+
+            static simd<S, N> divide(
+                const simd<S, N>& a, const simd<S, N>& b) noexcept
+            {
+                // There's no SIMD integer division, so this is done lane by
+                // lane to stay bit-exact.
+                alignas(simd<S, N>) S lanes[N];
+                alignas(simd<S, N>) S b_lanes[N];
+                a.store(lanes);
+                b.store(b_lanes);
+                for (int i = 0; i < N; ++i)
+                {
+                    lanes[i] = tue::detail_::fixed_divide<F>(
+                        lanes[i], b_lanes[i]);
+                }
+                return simd<S, N>::load(lanes);
+            }
+
+            static simd<S, N> sqrt(const simd<S, N>& a) noexcept
+            {
+                alignas(simd<S, N>) S lanes[N];
+                a.store(lanes);
+                for (int i = 0; i < N; ++i)
+                {
+                    lanes[i] = tue::detail_::fixed_sqrt<F>(lanes[i]);
+                }
+                return simd<S, N>::load(lanes);
+            }
+        };
+
+        template<int F, typename S, int N>
+        inline simd<S, N> fixed_multiply(
+            const simd<S, N>& a, const simd<S, N>& b) noexcept
+        {
+            return fixed_utils<S, F, N>::multiply(a, b);
+        }
+
+        template<typename S>
+        struct fixed_bits_traits
+        {
+            using storage_type = S;
+        };
+
+        template<typename S, int N>
+        struct fixed_bits_traits<simd<S, N>>
+        {
+            using storage_type = S;
+        };
+
+        template<int F, typename R>
+        inline R fixed_sin_quadrant_bits(const R& r) noexcept
+        {
+            using S = typename fixed_bits_traits<R>::storage_type;
+
+            // A minimax fit of sin(r*pi/2) over [0, 1] with p(1) == 1.
+            // The error is less than 0.0001 before rounding.
+            const auto c1 = R(fixed_from_double<S, F>(1.570243096594291));
+            const auto c3 = R(fixed_from_double<S, F>(-0.641711727427411));
+            const auto c5 = R(fixed_from_double<S, F>(0.07146863083311995));
+
+            const auto r2 = tue::detail_::fixed_multiply<F>(r, r);
+            auto p = tue::detail_::fixed_multiply<F>(r2, c5);
+            p = tue::detail_::fixed_multiply<F>(r2, R(p + c3));
+            return tue::detail_::fixed_multiply<F>(r, R(p + c1));
+        }
+
+        template<int I, int F, typename R>
+        inline void fixed_sincos_bits(
+            const R& x, R& sin_out, R& cos_out) noexcept
+        {
+            static_assert(I >= 2, "sin() and cos() need to represent 1");
+
+            using S = typename fixed_bits_traits<R>::storage_type;
+            constexpr int w = 8 * int(sizeof(S));
+
+            // Convert to a binary angle where a whole turn is 2^w so the
+            // range reduction is just wrap-around. The top two bits are then
+            // the quadrant and the rest are the angle within it.
+            constexpr auto k = S(w == 16 ? 10430 : 683565276);
+            const auto p = tue::detail_::fixed_multiply<F>(x, R(k));
+            const auto q = R(R(p >> (w - 2)) & R(3));
+            constexpr auto half = S(S(S(1) << (w - 2 - F)) >> 1);
+            const auto r = R(R(R(p & R((S(1) << (w - 2)) - 1)) + R(half))
+                >> (w - 2 - F));
+            const auto one = R(S(S(1) << F));
+
+            const auto a = fixed_sin_quadrant_bits<F>(r);
+            const auto b = fixed_sin_quadrant_bits<F>(R(one - r));
+
+            const auto swap = tue::math::not_equal(R(q & R(1)), R(0));
+            const auto s = tue::math::select(swap, b, a);
+            const auto c = tue::math::select(swap, a, b);
+
+            const auto negate_sin = tue::math::not_equal(R(q & R(2)), R(0));
+            const auto negate_cos =
+                tue::math::not_equal(R(R(q + R(1)) & R(2)), R(0));
+            sin_out = tue::math::select(negate_sin, R(-s), s);
+            cos_out = tue::math::select(negate_cos, R(-c), c);
+        }
+    }
+
+    // simd<T, 2> is itself a partial specialization, so 2-component
+    // simd's of fixed's would be ambiguous. They're declared here so using
+    // one is an incomplete type error instead.
+    template<int I, int F>
+    class simd<fixed<I, F>, 2>;
+
+    /*!
+     * \brief     A `simd` of `fixed`'s backed by a `simd` of their binary
+     *            representations.
+     * \details   `simd<fixed<16, 16>, 4>` is backed by an `int32x4` and
+     *            `simd<fixed<8, 8>, 8>` by an `int16x8`. Multiplication uses
+     *            SSE2 (`_mm_mulhi_epi16()` or `_mm_mul_epu32()` plus a shift)
+     *            when `TUE_SSE2` is defined. Division and `sqrt()` are done
+     *            lane by lane to stay bit-exact.
+     *
+     * \tparam I  The number of integer bits of each component.
+     * \tparam F  The number of fractional bits of each component.
+     * \tparam N  The component count. Must be `4`, `8`, `16`, `32`, or `64`.
+     */
+    template<int I, int F, int N>
+    class simd<fixed<I, F>, N>
+    {
+    public:
+        /*!
+         * \brief  This `simd` type's component type.
+         */
+        using component_type = fixed<I, F>;
+
+        /*!
+         * \brief  The `simd` type of the binary representations.
+         */
+        using bits_type = simd<typename component_type::storage_type, N>;
+
+        /*!
+         * \brief  This `simd` type's component count.
+         */
+        static constexpr int component_count = N;
+
+        /*!
+         * \brief  Whether or not this `simd` type is accelerated.
+         */
+        static constexpr bool is_accelerated = bits_type::is_accelerated;
+
+    private:
+        bits_type bits_;
+
+        static typename component_type::storage_type
+        bits_of(const component_type& x) noexcept
+        {
+            return x.bits();
+        }
+
+    public:
+        /*!
+         * \brief  Default constructs each component.
+         */
+        simd() noexcept = default;
+
+        /*!
+         * \brief    Constructs each component with the same value.
+         *
+         * \param x  The value to construct each component with.
+         */
+        explicit simd(const component_type& x) noexcept
+        :
+            bits_(x.bits())
+        {
+        }
+
+        /*!
+         * \brief     Constructs each component with the value of the
+         *            corresponding argument.
+         * \details   This overload is only available when `N` is `4`, `8`,
+         *            or `16`.
+         *
+         * \param x   The value to construct the first component with.
+         * \param xs  The values to construct the remaining components with.
+         */
+        template<typename... Xs,
+            typename = std::enable_if_t<sizeof...(Xs) + 1 == N>>
+        simd(const component_type& x, const Xs&... xs) noexcept
+        :
+            bits_(x.bits(), bits_of(xs)...)
+        {
+        }
+
+        /*!
+         * \brief       Constructs a `simd` from the binary representations of
+         *              its components.
+         *
+         * \param bits  The binary representations.
+         *
+         * \return      The new `simd`.
+         */
+        static simd from_bits(const bits_type& bits) noexcept
+        {
+            simd result;
+            result.bits_ = bits;
+            return result;
+        }
+
+        /*!
+         * \brief   Returns the binary representations of the components.
+         *
+         * \return  The binary representations of the components.
+         */
+        const bits_type& bits() const noexcept
+        {
+            return bits_;
+        }
+
+        /*!
+         * \brief   Returns a `simd` with each component set to `0`.
+         *
+         * \return  A `simd` with each component set to `0`.
+         */
+        static simd zero() noexcept
+        {
+            return from_bits(bits_type::zero());
+        }
+
+        /*!
+         * \brief       Loads a `simd` from aligned memory.
+         *
+         * \param data  A pointer to `N` aligned `fixed`'s.
+         *
+         * \return      The loaded `simd`.
+         */
+        static simd load(const component_type* data) noexcept
+        {
+            return from_bits(bits_type::load(reinterpret_cast<
+                const typename component_type::storage_type*>(data)));
+        }
+
+        /*!
+         * \brief       Loads a `simd` from unaligned memory.
+         *
+         * \param data  A pointer to `N` `fixed`'s.
+         *
+         * \return      The loaded `simd`.
+         */
+        static simd loadu(const component_type* data) noexcept
+        {
+            return from_bits(bits_type::loadu(reinterpret_cast<
+                const typename component_type::storage_type*>(data)));
+        }
+
+        /*!
+         * \brief       Stores this `simd` to aligned memory.
+         *
+         * \param data  A pointer to `N` aligned `fixed`'s.
+         */
+        void store(component_type* data) const noexcept
+        {
+            bits_.store(reinterpret_cast<
+                typename component_type::storage_type*>(data));
+        }
+
+        /*!
+         * \brief       Stores this `simd` to unaligned memory.
+         *
+         * \param data  A pointer to `N` `fixed`'s.
+         */
+        void storeu(component_type* data) const noexcept
+        {
+            bits_.storeu(reinterpret_cast<
+                typename component_type::storage_type*>(data));
+        }
+
+        /*!
+         * \brief   Returns a pointer to this `simd`'s underlying data.
+         *
+         * \return  A pointer to this `simd`'s underlying data.
+         */
+        const component_type* data() const noexcept
+        {
+            return reinterpret_cast<const component_type*>(bits_.data());
+        }
+
+        /*!
+         * \brief   Returns a pointer to this `simd`'s underlying data.
+         *
+         * \return  A pointer to this `simd`'s underlying data.
+         */
+        component_type* data() noexcept
+        {
+            return reinterpret_cast<component_type*>(bits_.data());
+        }
+
+        /*!
+         * \brief    Adds each component of `s` to each component of this
+         *           `simd`.
+         *
+         * \param s  The values to add.
+         *
+         * \return   A reference to this `simd`.
+         */
+        simd& operator+=(const simd& s) noexcept
+        {
+            bits_ += s.bits_;
+            return *this;
+        }
+
+        /*!
+         * \brief    Subtracts each component of `s` from each component of
+         *           this `simd`.
+         *
+         * \param s  The values to subtract.
+         *
+         * \return   A reference to this `simd`.
+         */
+        simd& operator-=(const simd& s) noexcept
+        {
+            bits_ -= s.bits_;
+            return *this;
+        }
+
+        /*!
+         * \brief    Multiplies each component of this `simd` by each
+         *           component of `s`.
+         *
+         * \param s  The values to multiply by.
+         *
+         * \return   A reference to this `simd`.
+         */
+        simd& operator*=(const simd& s) noexcept
+        {
+            bits_ = tue::detail_::fixed_multiply<F>(bits_, s.bits_);
+            return *this;
+        }
+
+        /*!
+         * \brief    Divides each component of this `simd` by each component
+         *           of `s`.
+         *
+         * \param s  The values to divide by. Must not contain `0`.
+         *
+         * \return   A reference to this `simd`.
+         */
+        simd& operator/=(const simd& s) noexcept
+        {
+            bits_ = tue::detail_::fixed_utils<
+                typename component_type::storage_type, F, N>::divide(
+                    bits_, s.bits_);
+            return *this;
+        }
+    };
+
+    /*!
+     * \addtogroup  fixed_hpp
+     * @{
+     */
+
+    /*!
+     * \brief     Negates each component of `s`.
+     *
+     * \param s   A `simd` of `fixed`'s.
+     *
+     * \return    The negation of each component of `s`.
+     */
+    template<int I, int F, int N>
+    inline simd<fixed<I, F>, N> operator-(
+        const simd<fixed<I, F>, N>& s) noexcept
+    {
+        return simd<fixed<I, F>, N>::from_bits(-s.bits());
+    }
+
+    /*!
+     * \brief      Adds each pair of corresponding components.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     The sums of each pair of corresponding components.
+     */
+    template<int I, int F, int N>
+    inline simd<fixed<I, F>, N> operator+(
+        const simd<fixed<I, F>, N>& lhs,
+        const simd<fixed<I, F>, N>& rhs) noexcept
+    {
+        return simd<fixed<I, F>, N>::from_bits(lhs.bits() + rhs.bits());
+    }
+
+    /*!
+     * \brief      Subtracts each pair of corresponding components.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     The differences of each pair of corresponding components.
+     */
+    template<int I, int F, int N>
+    inline simd<fixed<I, F>, N> operator-(
+        const simd<fixed<I, F>, N>& lhs,
+        const simd<fixed<I, F>, N>& rhs) noexcept
+    {
+        return simd<fixed<I, F>, N>::from_bits(lhs.bits() - rhs.bits());
+    }
+
+    /*!
+     * \brief      Multiplies each pair of corresponding components.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     The products of each pair of corresponding components.
+     */
+    template<int I, int F, int N>
+    inline simd<fixed<I, F>, N> operator*(
+        const simd<fixed<I, F>, N>& lhs,
+        const simd<fixed<I, F>, N>& rhs) noexcept
+    {
+        return simd<fixed<I, F>, N>::from_bits(
+            tue::detail_::fixed_multiply<F>(lhs.bits(), rhs.bits()));
+    }
+
+    /*!
+     * \brief      Divides each pair of corresponding components.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand. Must not contain `0`.
+     *
+     * \return     The quotients of each pair of corresponding components.
+     */
+    template<int I, int F, int N>
+    inline simd<fixed<I, F>, N> operator/(
+        const simd<fixed<I, F>, N>& lhs,
+        const simd<fixed<I, F>, N>& rhs) noexcept
+    {
+        auto result = lhs;
+        result /= rhs;
+        return result;
+    }
+
+    /*!
+     * \brief      Determines whether or not two `simd`'s of `fixed`'s
+     *             compare equal.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if every pair of corresponding components compare
+     *             equal and `false` otherwise.
+     */
+    template<int I, int F, int N>
+    inline bool operator==(
+        const simd<fixed<I, F>, N>& lhs,
+        const simd<fixed<I, F>, N>& rhs) noexcept
+    {
+        return lhs.bits() == rhs.bits();
+    }
+
+    /*!
+     * \brief      Determines whether or not two `simd`'s of `fixed`'s
+     *             compare not equal.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if any pair of corresponding components don't
+     *             compare equal and `false` otherwise.
+     */
+    template<int I, int F, int N>
+    inline bool operator!=(
+        const simd<fixed<I, F>, N>& lhs,
+        const simd<fixed<I, F>, N>& rhs) noexcept
+    {
+        return lhs.bits() != rhs.bits();
+    }
+
+    /*!@}*/
+
+    namespace math
+    {
+        /*!
+         * \addtogroup  fixed_hpp
+         * @{
+         */
+
+        /*!
+         * \brief     Computes the absolute value of `x`.
+         *
+         * \param x   A `fixed`.
+         *
+         * \return    The absolute value of `x`.
+         */
+        template<int I, int F>
+        inline constexpr fixed<I, F> abs(const fixed<I, F>& x) noexcept
+        {
+            return x.bits() < 0 ? -x : x;
+        }
+
+        /*!
+         * \brief     Determines the minimum of two `fixed`'s.
+         *
+         * \param x   A `fixed`.
+         * \param y   Another `fixed`.
+         *
+         * \return    The minimum of `x` and `y`.
+         */
+        template<int I, int F>
+        inline constexpr fixed<I, F> min(
+            const fixed<I, F>& x, const fixed<I, F>& y) noexcept
+        {
+            return y < x ? y : x;
+        }
+
+        /*!
+         * \brief     Determines the maximum of two `fixed`'s.
+         *
+         * \param x   A `fixed`.
+         * \param y   Another `fixed`.
+         *
+         * \return    The maximum of `x` and `y`.
+         */
+        template<int I, int F>
+        inline constexpr fixed<I, F> max(
+            const fixed<I, F>& x, const fixed<I, F>& y) noexcept
+        {
+            return x < y ? y : x;
+        }
+
+        /*!
+         * \brief     Computes the square root of `x` (rounded down).
+         *
+         * \param x   A `fixed`. Negative values return `0`.
+         *
+         * \return    The square root of `x`.
+         */
+        template<int I, int F>
+        inline fixed<I, F> sqrt(const fixed<I, F>& x) noexcept
+        {
+            return fixed<I, F>::from_bits(
+                tue::detail_::fixed_sqrt<F>(x.bits()));
+        }
+
+        /*!
+         * \brief          Approximates the sine and cosine of `x` (measured
+         *                 in radians).
+         * \details        The results are within `0.0001` plus three units
+         *                 in the last place of the true values (about
+         *                 `0.00015` for Q16.16 and `0.012` for Q8.8). `I`
+         *                 must be at least `2`.
+         *
+         * \param x        A `fixed`.
+         * \param sin_out  A reference to where the sine will be stored.
+         * \param cos_out  A reference to where the cosine will be stored.
+         */
+        template<int I, int F>
+        inline void sincos(const fixed<I, F>& x,
+            fixed<I, F>& sin_out, fixed<I, F>& cos_out) noexcept
+        {
+            typename fixed<I, F>::storage_type s, c;
+            tue::detail_::fixed_sincos_bits<I, F>(x.bits(), s, c);
+            sin_out = fixed<I, F>::from_bits(s);
+            cos_out = fixed<I, F>::from_bits(c);
+        }
+
+        /*!
+         * \brief     Approximates the sine of `x` (measured in radians).
+         * \details   See `sincos()`.
+         *
+         * \param x   A `fixed`.
+         *
+         * \return    The sine of `x`.
+         */
+        template<int I, int F>
+        inline fixed<I, F> sin(const fixed<I, F>& x) noexcept
+        {
+            fixed<I, F> s, c;
+            tue::math::sincos(x, s, c);
+            return s;
+        }
+
+        /*!
+         * \brief     Approximates the cosine of `x` (measured in radians).
+         * \details   See `sincos()`.
+         *
+         * \param x   A `fixed`.
+         *
+         * \return    The cosine of `x`.
+         */
+        template<int I, int F>
+        inline fixed<I, F> cos(const fixed<I, F>& x) noexcept
+        {
+            fixed<I, F> s, c;
+            tue::math::sincos(x, s, c);
+            return c;
+        }
+
+        /*!
+         * \brief      Computes whether or not `lhs` is less than `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `trueX` if `lhs` is less than `rhs` and `falseX`
+         *             otherwise (where `X` is the number of bits in a
+         *             `fixed<I, F>`).
+         */
+        template<int I, int F>
+        inline constexpr sized_bool_t<sizeof(fixed<I, F>)>
+        less(const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+        {
+            using U = sized_bool_t<sizeof(fixed<I, F>)>;
+            return lhs < rhs ? U(~0LL) : U(0LL);
+        }
+
+        /*!
+         * \brief      Computes whether or not `lhs` is less than or equal to
+         *             `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `trueX` if `lhs` is less than or equal to `rhs` and
+         *             `falseX` otherwise (where `X` is the number of bits in a
+         *             `fixed<I, F>`).
+         */
+        template<int I, int F>
+        inline constexpr sized_bool_t<sizeof(fixed<I, F>)>
+        less_equal(const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+        {
+            using U = sized_bool_t<sizeof(fixed<I, F>)>;
+            return lhs <= rhs ? U(~0LL) : U(0LL);
+        }
+
+        /*!
+         * \brief      Computes whether or not `lhs` is greater than `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `trueX` if `lhs` is greater than `rhs` and `falseX`
+         *             otherwise (where `X` is the number of bits in a
+         *             `fixed<I, F>`).
+         */
+        template<int I, int F>
+        inline constexpr sized_bool_t<sizeof(fixed<I, F>)>
+        greater(const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+        {
+            using U = sized_bool_t<sizeof(fixed<I, F>)>;
+            return lhs > rhs ? U(~0LL) : U(0LL);
+        }
+
+        /*!
+         * \brief      Computes whether or not `lhs` is greater than or equal to
+         *             `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `trueX` if `lhs` is greater than or equal to `rhs` and
+         *             `falseX` otherwise (where `X` is the number of bits in a
+         *             `fixed<I, F>`).
+         */
+        template<int I, int F>
+        inline constexpr sized_bool_t<sizeof(fixed<I, F>)>
+        greater_equal(const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+        {
+            using U = sized_bool_t<sizeof(fixed<I, F>)>;
+            return lhs >= rhs ? U(~0LL) : U(0LL);
+        }
+
+        /*!
+         * \brief      Computes whether or not `lhs` is equal to `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `trueX` if `lhs` is equal to `rhs` and `falseX`
+         *             otherwise (where `X` is the number of bits in a
+         *             `fixed<I, F>`).
+         */
+        template<int I, int F>
+        inline constexpr sized_bool_t<sizeof(fixed<I, F>)>
+        equal(const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+        {
+            using U = sized_bool_t<sizeof(fixed<I, F>)>;
+            return lhs == rhs ? U(~0LL) : U(0LL);
+        }
+
+        /*!
+         * \brief      Computes whether or not `lhs` is not equal to `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `trueX` if `lhs` is not equal to `rhs` and `falseX`
+         *             otherwise (where `X` is the number of bits in a
+         *             `fixed<I, F>`).
+         */
+        template<int I, int F>
+        inline constexpr sized_bool_t<sizeof(fixed<I, F>)>
+        not_equal(const fixed<I, F>& lhs, const fixed<I, F>& rhs) noexcept
+        {
+            using U = sized_bool_t<sizeof(fixed<I, F>)>;
+            return lhs != rhs ? U(~0LL) : U(0LL);
+        }
+
+        /*!
+         * \brief            Selects a return value based on `condition`.
+         *
+         * \tparam T         The condition type.
+         *
+         * \param condition  The condition.
+         * \param value      The return value when condition is `trueX`.
+         * \param otherwise  The return value when condition is `falseX`.
+         *
+         * \return           `value` or `otherwise` depending on `condition`.
+         */
+        template<typename T, int I, int F>
+        inline std::enable_if_t<
+            is_sized_bool<T>::value && sizeof(T) == sizeof(fixed<I, F>),
+            fixed<I, F>>
+        select(T condition,
+            const fixed<I, F>& value, const fixed<I, F>& otherwise) noexcept
+        {
+            return fixed<I, F>::from_bits(tue::math::select(
+                condition, value.bits(), otherwise.bits()));
+        }
+
+        /*!
+         * \brief     Computes `tue::math::abs()` for each component of `s`.
+         *
+         * \param s   A `simd` of `fixed`'s.
+         *
+         * \return    `tue::math::abs()` for each component of `s`.
+         */
+        template<int I, int F, int N>
+        inline simd<fixed<I, F>, N> abs(
+            const simd<fixed<I, F>, N>& s) noexcept
+        {
+            return simd<fixed<I, F>, N>::from_bits(
+                tue::math::abs(s.bits()));
+        }
+
+        /*!
+         * \brief     Computes `tue::math::min()` for each pair of
+         *            corresponding components of `s1` and `s2`.
+         *
+         * \param s1  A `simd` of `fixed`'s.
+         * \param s2  Another `simd` of `fixed`'s.
+         *
+         * \return    `tue::math::min()` for each pair of corresponding
+         *            components of `s1` and `s2`.
+         */
+        template<int I, int F, int N>
+        inline simd<fixed<I, F>, N> min(
+            const simd<fixed<I, F>, N>& s1,
+            const simd<fixed<I, F>, N>& s2) noexcept
+        {
+            return simd<fixed<I, F>, N>::from_bits(
+                tue::math::min(s1.bits(), s2.bits()));
+        }
+
+        /*!
+         * \brief     Computes `tue::math::max()` for each pair of
+         *            corresponding components of `s1` and `s2`.
+         *
+         * \param s1  A `simd` of `fixed`'s.
+         * \param s2  Another `simd` of `fixed`'s.
+         *
+         * \return    `tue::math::max()` for each pair of corresponding
+         *            components of `s1` and `s2`.
+         */
+        template<int I, int F, int N>
+        inline simd<fixed<I, F>, N> max(
+            const simd<fixed<I, F>, N>& s1,
+            const simd<fixed<I, F>, N>& s2) noexcept
+        {
+            return simd<fixed<I, F>, N>::from_bits(
+                tue::math::max(s1.bits(), s2.bits()));
+        }
+
+        /*!
+         * \brief     Computes `tue::math::sqrt()` for each component of `s`.
+         *
+         * \param s   A `simd` of `fixed`'s.
+         *
+         * \return    `tue::math::sqrt()` for each component of `s`.
+         */
+        template<int I, int F, int N>
+        inline simd<fixed<I, F>, N> sqrt(
+            const simd<fixed<I, F>, N>& s) noexcept
+        {
+            return simd<fixed<I, F>, N>::from_bits(tue::detail_::fixed_utils<
+                typename fixed<I, F>::storage_type, F, N>::sqrt(s.bits()));
+        }
+
+        /*!
+         * \brief          Computes `tue::math::sincos()` for each component
+         *                 of `s`.
+         *
+         * \param s        A `simd` of `fixed`'s.
+         * \param sin_out  A reference to where the sines will be stored.
+         * \param cos_out  A reference to where the cosines will be stored.
+         */
+        template<int I, int F, int N>
+        inline void sincos(const simd<fixed<I, F>, N>& s,
+            simd<fixed<I, F>, N>& sin_out,
+            simd<fixed<I, F>, N>& cos_out) noexcept
+        {
+            typename simd<fixed<I, F>, N>::bits_type sb, cb;
+            tue::detail_::fixed_sincos_bits<I, F>(s.bits(), sb, cb);
+            sin_out = simd<fixed<I, F>, N>::from_bits(sb);
+            cos_out = simd<fixed<I, F>, N>::from_bits(cb);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::sin()` for each component of `s`.
+         *
+         * \param s   A `simd` of `fixed`'s.
+         *
+         * \return    `tue::math::sin()` for each component of `s`.
+         */
+        template<int I, int F, int N>
+        inline simd<fixed<I, F>, N> sin(
+            const simd<fixed<I, F>, N>& s) noexcept
+        {
+            simd<fixed<I, F>, N> sin_out, cos_out;
+            tue::math::sincos(s, sin_out, cos_out);
+            return sin_out;
+        }
+
+        /*!
+         * \brief     Computes `tue::math::cos()` for each component of `s`.
+         *
+         * \param s   A `simd` of `fixed`'s.
+         *
+         * \return    `tue::math::cos()` for each component of `s`.
+         */
+        template<int I, int F, int N>
+        inline simd<fixed<I, F>, N> cos(
+            const simd<fixed<I, F>, N>& s) noexcept
+        {
+            simd<fixed<I, F>, N> sin_out, cos_out;
+            tue::math::sincos(s, sin_out, cos_out);
+            return cos_out;
+        }
+
+        /*!
+         * \brief      Computes `tue::math::less()` for each corresponding
+         *             pair of components from `lhs` and `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `tue::math::less()` for each corresponding pair of
+         *             components from `lhs` and `rhs`.
+         */
+        template<int I, int F, int N>
+        inline simd<sized_bool_t<sizeof(fixed<I, F>)>, N> less(
+            const simd<fixed<I, F>, N>& lhs,
+            const simd<fixed<I, F>, N>& rhs) noexcept
+        {
+            return tue::math::less(lhs.bits(), rhs.bits());
+        }
+
+        /*!
+         * \brief      Computes `tue::math::less_equal()` for each corresponding
+         *             pair of components from `lhs` and `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `tue::math::less_equal()` for each corresponding pair of
+         *             components from `lhs` and `rhs`.
+         */
+        template<int I, int F, int N>
+        inline simd<sized_bool_t<sizeof(fixed<I, F>)>, N> less_equal(
+            const simd<fixed<I, F>, N>& lhs,
+            const simd<fixed<I, F>, N>& rhs) noexcept
+        {
+            return tue::math::less_equal(lhs.bits(), rhs.bits());
+        }
+
+        /*!
+         * \brief      Computes `tue::math::greater()` for each corresponding
+         *             pair of components from `lhs` and `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `tue::math::greater()` for each corresponding pair of
+         *             components from `lhs` and `rhs`.
+         */
+        template<int I, int F, int N>
+        inline simd<sized_bool_t<sizeof(fixed<I, F>)>, N> greater(
+            const simd<fixed<I, F>, N>& lhs,
+            const simd<fixed<I, F>, N>& rhs) noexcept
+        {
+            return tue::math::greater(lhs.bits(), rhs.bits());
+        }
+
+        /*!
+         * \brief      Computes `tue::math::greater_equal()` for each
+         *             corresponding pair of components from `lhs` and `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `tue::math::greater_equal()` for each corresponding pair
+         *             of components from `lhs` and `rhs`.
+         */
+        template<int I, int F, int N>
+        inline simd<sized_bool_t<sizeof(fixed<I, F>)>, N> greater_equal(
+            const simd<fixed<I, F>, N>& lhs,
+            const simd<fixed<I, F>, N>& rhs) noexcept
+        {
+            return tue::math::greater_equal(lhs.bits(), rhs.bits());
+        }
+
+        /*!
+         * \brief      Computes `tue::math::equal()` for each corresponding
+         *             pair of components from `lhs` and `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `tue::math::equal()` for each corresponding pair of
+         *             components from `lhs` and `rhs`.
+         */
+        template<int I, int F, int N>
+        inline simd<sized_bool_t<sizeof(fixed<I, F>)>, N> equal(
+            const simd<fixed<I, F>, N>& lhs,
+            const simd<fixed<I, F>, N>& rhs) noexcept
+        {
+            return tue::math::equal(lhs.bits(), rhs.bits());
+        }
+
+        /*!
+         * \brief      Computes `tue::math::not_equal()` for each corresponding
+         *             pair of components from `lhs` and `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     `tue::math::not_equal()` for each corresponding pair of
+         *             components from `lhs` and `rhs`.
+         */
+        template<int I, int F, int N>
+        inline simd<sized_bool_t<sizeof(fixed<I, F>)>, N> not_equal(
+            const simd<fixed<I, F>, N>& lhs,
+            const simd<fixed<I, F>, N>& rhs) noexcept
+        {
+            return tue::math::not_equal(lhs.bits(), rhs.bits());
+        }
+
+        /*!
+         * \brief             Selects between the corresponding components of
+         *                    `values` and `otherwise` based on `conditions`.
+         *
+         * \tparam T          The component type of `conditions`.
+         *
+         * \param conditions  The conditions.
+         * \param values      The return values when the conditions are true.
+         * \param otherwise   The return values when the conditions are
+         *                    false.
+         *
+         * \return            The selected components.
+         */
+        template<typename T, int I, int F, int N>
+        inline std::enable_if_t<
+            is_sized_bool<T>::value && sizeof(T) == sizeof(fixed<I, F>),
+            simd<fixed<I, F>, N>>
+        select(
+            const simd<T, N>& conditions,
+            const simd<fixed<I, F>, N>& values,
+            const simd<fixed<I, F>, N>& otherwise) noexcept
+        {
+            return simd<fixed<I, F>, N>::from_bits(tue::math::select(
+                conditions, values.bits(), otherwise.bits()));
+        }
+
+        /*!@}*/
+    }
+}
@@ -0,0 +1,464 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+// The float16 conversion routines in this file are based on Fabian "ryg"
+// Giesen's public domain half-precision conversion code originally published
+// at https://gist.github.com/rygorous/2156668.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "detail_/float_bits.hpp"
+#include "simd.hpp"
+
+#ifdef TUE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef TUE_F16C
+#include <immintrin.h>
+#endif
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline std::uint16_t float32_to_float16_bits(float x) noexcept
+        {
+            const std::uint32_t f32infty = 255u << 23;
+            const std::uint32_t f16max = (127u + 16u) << 23;
+            const std::uint32_t denorm_magic =
+                ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+            auto u = tue::detail_::float_bits(x);
+            const auto sign = u & 0x80000000u;
+            u ^= sign;
+
+            std::uint32_t o;
+            if (u >= f16max)
+            {
+                // Inf stays Inf and NaN becomes a quiet NaN
+                o = u > f32infty ? 0x7E00u : 0x7C00u;
+            }
+            else if (u < (113u << 23))
+            {
+                // The result is subnormal or zero, so let the FPU do the
+                // rounding by adding a magic value.
+                o = tue::detail_::float_bits(
+                    tue::detail_::bits_float(u)
+                        + tue::detail_::bits_float(denorm_magic))
+                    - denorm_magic;
+            }
+            else
+            {
+                // Rebias the exponent and round to nearest even
+                const auto mant_odd = (u >> 13) & 1u;
+                u += ((15u - 127u) << 23) + 0xFFFu;
+                u += mant_odd;
+                o = u >> 13;
+            }
+
+            return static_cast<std::uint16_t>(o | (sign >> 16));
+        }
+
+        inline float float16_bits_to_float32(std::uint16_t h) noexcept
+        {
+            const std::uint32_t shifted_exp = 0x7C00u << 13;
+            const float magic = tue::detail_::bits_float(113u << 23);
+
+            auto o = (std::uint32_t(h) & 0x7FFFu) << 13;
+            const auto exp = shifted_exp & o;
+            o += (127u - 15u) << 23;
+
+            if (exp == shifted_exp)
+            {
+                // Inf or NaN
+                o += (128u - 16u) << 23;
+            }
+            else if (exp == 0)
+            {
+                // Zero or subnormal, so renormalize
+                o += 1u << 23;
+                o = tue::detail_::float_bits(
+                    tue::detail_::bits_float(o) - magic);
+            }
+
+            o |= (std::uint32_t(h) & 0x8000u) << 16;
+            return tue::detail_::bits_float(o);
+        }
+    }
+
+    /*!
+     * \defgroup  float16_hpp <tue/float16.hpp>
+     *
+     * \brief     The `float16` half-precision storage type and its associated
+     *            conversion functions.
+     * @{
+     */
+
+    /*!
+     * \brief    A 16-bit IEEE 754 half-precision floating-point value.
+     * \details  `float16` is a storage type only. It doesn't define any
+     *           arithmetic operators. Convert to `float` (or to `float32x4`,
+     *           `float32x8`, etc. with `load_float16()`) to do math with it.
+     *           Conversions from `float` round to nearest even.
+     */
+    class float16
+    {
+        std::uint16_t bits_;
+
+        struct from_bits_tag {};
+
+        constexpr float16(std::uint16_t bits, from_bits_tag) noexcept
+        :
+            bits_(bits)
+        {
+        }
+
+    public:
+        /*!
+         * \brief  Default constructs a `float16` with an indeterminate value.
+         */
+        float16() noexcept = default;
+
+        /*!
+         * \brief    Constructs a `float16` with the value of `x` rounded to
+         *           the nearest representable half-precision value.
+         *
+         * \param x  The value to convert.
+         */
+        explicit float16(float x) noexcept
+        :
+            bits_(tue::detail_::float32_to_float16_bits(x))
+        {
+        }
+
+        /*!
+         * \brief       Constructs a `float16` from its binary representation.
+         *
+         * \param bits  The binary representation.
+         *
+         * \return      The new `float16`.
+         */
+        static constexpr float16 from_bits(std::uint16_t bits) noexcept
+        {
+            return float16(bits, from_bits_tag());
+        }
+
+        /*!
+         * \brief   Returns the binary representation of this `float16`.
+         *
+         * \return  The binary representation of this `float16`.
+         */
+        constexpr std::uint16_t bits() const noexcept
+        {
+            return bits_;
+        }
+
+        /*!
+         * \brief   Converts this `float16` to a `float`. The conversion is
+         *          exact.
+         *
+         * \return  This `float16` as a `float`.
+         */
+        explicit operator float() const noexcept
+        {
+            return tue::detail_::float16_bits_to_float32(bits_);
+        }
+    };
+
+    /*!@}*/
+
+    static_assert(sizeof(float16) == 2, "float16 is not 16-bits wide");
+
+    namespace detail_
+    {
+#ifdef TUE_SSE2
+        inline __m128 float16x4_to_float32x4(__m128i h) noexcept
+        {
+#ifdef TUE_F16C
+            return _mm_cvtph_ps(h);
+#else
+            const auto mask_nosign = _mm_set1_epi32(0x7FFF);
+            const auto magic = _mm_castsi128_ps(
+                _mm_set1_epi32((254 - 15) << 23));
+            const auto was_infnan = _mm_set1_epi32(0x7BFF);
+            const auto exp_infnan = _mm_castsi128_ps(
+                _mm_set1_epi32(255 << 23));
+
+            // Widen each 16-bit half to 32 bits
+            h = _mm_unpacklo_epi16(h, _mm_setzero_si128());
+
+            const auto expmant = _mm_and_si128(mask_nosign, h);
+            const auto justsign = _mm_xor_si128(h, expmant);
+            const auto shifted = _mm_slli_epi32(expmant, 13);
+            const auto scaled = _mm_mul_ps(_mm_castsi128_ps(shifted), magic);
+            const auto b_wasinfnan = _mm_cmpgt_epi32(expmant, was_infnan);
+            const auto sign = _mm_slli_epi32(justsign, 16);
+            const auto infnanexp = _mm_and_ps(
+                _mm_castsi128_ps(b_wasinfnan), exp_infnan);
+            const auto sign_inf = _mm_or_ps(
+                _mm_castsi128_ps(sign), infnanexp);
+
+            return _mm_or_ps(scaled, sign_inf);
+#endif
+        }
+
+        inline __m128i float32x4_to_float16x4(__m128 f) noexcept
+        {
+#ifdef TUE_F16C
+            return _mm_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT);
+#else
+            const auto mask_sign = _mm_set1_epi32(int(0x80000000u));
+            const auto c_f16max = _mm_set1_epi32((127 + 16) << 23);
+            const auto c_nanbit = _mm_set1_epi32(0x200);
+            const auto c_infty_as_fp16 = _mm_set1_epi32(0x7C00);
+            const auto c_min_normal = _mm_set1_epi32((127 - 14) << 23);
+            const auto c_subnorm_magic = _mm_set1_epi32(
+                ((127 - 15) + (23 - 10) + 1) << 23);
+            const auto c_normal_bias = _mm_set1_epi32(
+                0xFFF - ((127 - 15) << 23));
+
+            const auto justsign = _mm_and_ps(_mm_castsi128_ps(mask_sign), f);
+            const auto absf = _mm_xor_ps(f, justsign);
+            const auto absf_int = _mm_castps_si128(absf);
+            const auto b_isnan = _mm_cmpunord_ps(absf, absf);
+            const auto b_isregular = _mm_cmpgt_epi32(c_f16max, absf_int);
+            const auto nanbit = _mm_and_si128(
+                _mm_castps_si128(b_isnan), c_nanbit);
+            const auto inf_or_nan = _mm_or_si128(nanbit, c_infty_as_fp16);
+            const auto b_issub = _mm_cmpgt_epi32(c_min_normal, absf_int);
+
+            // The result is subnormal, so let the FPU do the rounding
+            const auto subnorm1 = _mm_add_ps(
+                absf, _mm_castsi128_ps(c_subnorm_magic));
+            const auto subnorm2 = _mm_sub_epi32(
+                _mm_castps_si128(subnorm1), c_subnorm_magic);
+
+            // The result is normal, so rebias and round to nearest even
+            const auto mantoddbit = _mm_slli_epi32(absf_int, 31 - 13);
+            const auto mantodd = _mm_srai_epi32(mantoddbit, 31);
+            const auto round1 = _mm_add_epi32(absf_int, c_normal_bias);
+            const auto round2 = _mm_sub_epi32(round1, mantodd);
+            const auto normal = _mm_srli_epi32(round2, 13);
+
+            const auto nonspecial = _mm_or_si128(
+                _mm_and_si128(subnorm2, b_issub),
+                _mm_andnot_si128(b_issub, normal));
+
+            const auto joined = _mm_or_si128(
+                _mm_and_si128(nonspecial, b_isregular),
+                _mm_andnot_si128(b_isregular, inf_or_nan));
+
+            // The sign is shifted arithmetically so that the saturating pack
+            // below keeps every value intact.
+            const auto sign_shift = _mm_srai_epi32(
+                _mm_castps_si128(justsign), 16);
+
+            const auto result = _mm_or_si128(joined, sign_shift);
+            return _mm_packs_epi32(result, result);
+#endif
+        }
+#endif
+
+        template<int N>
+        struct float16_utils
+        {
+            static simd<float, N> load(const float16* data) noexcept
+            {
+                simd<float, N> result;
+                const auto rimpl =
+                    reinterpret_cast<simd<float, N/2>*>(&result);
+                rimpl[0] = float16_utils<N/2>::load(data);
+                rimpl[1] = float16_utils<N/2>::load(data + N/2);
+                return result;
+            }
+
+            static void store(
+                const simd<float, N>& s, float16* data) noexcept
+            {
+                const auto simpl =
+                    reinterpret_cast<const simd<float, N/2>*>(&s);
+                float16_utils<N/2>::store(simpl[0], data);
+                float16_utils<N/2>::store(simpl[1], data + N/2);
+            }
+        };
+
+        template<>
+        struct float16_utils<2>
+        {
+            static float32x2 load(const float16* data) noexcept
+            {
+                return { float(data[0]), float(data[1]) };
+            }
+
+            static void store(const float32x2& s, float16* data) noexcept
+            {
+                data[0] = float16(s.data()[0]);
+                data[1] = float16(s.data()[1]);
+            }
+        };
+
+        template<>
+        struct float16_utils<4>
+        {
+            static float32x4 load(const float16* data) noexcept
+            {
+#ifdef TUE_SSE2
+                return tue::detail_::float16x4_to_float32x4(
+                    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+#else
+                return {
+                    float(data[0]), float(data[1]),
+                    float(data[2]), float(data[3]),
+                };
+#endif
+            }
+
+            static void store(const float32x4& s, float16* data) noexcept
+            {
+#ifdef TUE_SSE2
+                _mm_storel_epi64(
+                    reinterpret_cast<__m128i*>(data),
+                    tue::detail_::float32x4_to_float16x4(s));
+#else
+                data[0] = float16(s.data()[0]);
+                data[1] = float16(s.data()[1]);
+                data[2] = float16(s.data()[2]);
+                data[3] = float16(s.data()[3]);
+#endif
+            }
+        };
+
+#if defined(TUE_AVX) && defined(TUE_F16C)
+        template<>
+        struct float16_utils<8>
+        {
+            static float32x8 load(const float16* data) noexcept
+            {
+                alignas(float32x8) float lanes[8];
+                _mm256_store_ps(lanes, _mm256_cvtph_ps(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data))));
+                return float32x8::load(lanes);
+            }
+
+            static void store(const float32x8& s, float16* data) noexcept
+            {
+                alignas(float32x8) float lanes[8];
+                s.store(lanes);
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(data),
+                    _mm256_cvtps_ph(
+                        _mm256_load_ps(lanes), _MM_FROUND_TO_NEAREST_INT));
+            }
+        };
+
+        // The number of values convert_n() converts at once
+        constexpr std::size_t float16_convert_width = 8;
+#else
+        constexpr std::size_t float16_convert_width = 4;
+#endif
+    }
+
+    /*!
+     * \addtogroup  float16_hpp
+     * @{
+     */
+
+    /*!
+     * \brief       Loads `N` consecutive `float16` values and converts them
+     *              to an `N`-component `float` SIMD vector.
+     * \details     `data` doesn't need to be aligned. Conversion uses F16C
+     *              intrinsics when `TUE_F16C` is defined (8 components at a
+     *              time when `TUE_AVX` is defined too) and an SSE2 integer
+     *              fallback when only `TUE_SSE2` is defined.
+     *
+     * \tparam N    The component count of the returned `simd`.
+     *
+     * \param data  A pointer to at least `N` `float16` values.
+     *
+     * \return      The converted `simd`.
+     */
+    template<int N>
+    inline simd<float, N> load_float16(const float16* data) noexcept
+    {
+        return tue::detail_::float16_utils<N>::load(data);
+    }
+
+    /*!
+     * \brief       Converts each component of `s` to `float16` (rounding to
+     *              nearest even) and stores them to `N` consecutive
+     *              `float16` values.
+     * \details     `data` doesn't need to be aligned.
+     *
+     * \tparam N    The component count of `s`.
+     *
+     * \param s     The `simd` to convert.
+     * \param data  A pointer to at least `N` `float16` values.
+     */
+    template<int N>
+    inline void store_float16(const simd<float, N>& s, float16* data) noexcept
+    {
+        tue::detail_::float16_utils<N>::store(s, data);
+    }
+
+    /*!
+     * \brief        Converts `count` `float16` values to `float`.
+     *
+     * \param src    A pointer to the values to convert.
+     * \param count  The number of values to convert.
+     * \param dst    A pointer to where the converted values will be stored.
+     */
+    inline void convert_n(
+        const float16* src, std::size_t count, float* dst) noexcept
+    {
+        constexpr auto n = tue::detail_::float16_convert_width;
+        const auto blocked_count = count & ~(n - 1);
+
+        std::size_t i = 0;
+        for (; i < blocked_count; i += n)
+        {
+            tue::load_float16<int(n)>(src + i).storeu(dst + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            dst[i] = float(src[i]);
+        }
+    }
+
+    /*!
+     * \brief        Converts `count` `float` values to `float16` (rounding to
+     *               nearest even).
+     *
+     * \param src    A pointer to the values to convert.
+     * \param count  The number of values to convert.
+     * \param dst    A pointer to where the converted values will be stored.
+     */
+    inline void convert_n(
+        const float* src, std::size_t count, float16* dst) noexcept
+    {
+        constexpr auto n = tue::detail_::float16_convert_width;
+        const auto blocked_count = count & ~(n - 1);
+
+        std::size_t i = 0;
+        for (; i < blocked_count; i += n)
+        {
+            tue::store_float16(simd<float, int(n)>::loadu(src + i), dst + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            dst[i] = float16(src[i]);
+        }
+    }
+
+    /*!@}*/
+}
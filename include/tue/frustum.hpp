@@ -0,0 +1,266 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mat.hpp"
+#include "math.hpp"
+#include "simd.hpp"
+#include "sized_bool.hpp"
+#include "vec.hpp"
+
+#ifdef TUE_SSE
+#include <xmmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
+namespace tue
+{
+    /*!
+     * \defgroup  frustum_hpp <tue/frustum.hpp>
+     *
+     * \brief     The `frustum` class template and batched culling functions.
+     *
+     * @{
+     */
+
+    /*!
+     * \brief     A view frustum as six inward-facing planes.
+     * \details   Each plane is a `vec4` whose first three components are its
+     *            unit normal and whose fourth is its offset, so a point `p`
+     *            is on the inside of the plane if
+     *            `math::dot(vec4(p, 1), plane) >= 0`. The planes are, in
+     *            order, left, right, bottom, top, near, and far.
+     *
+     * \tparam T  The component type.
+     */
+    template<typename T>
+    class frustum
+    {
+        vec4<T> planes_[6];
+
+    public:
+        /*!
+         * \brief  This `frustum` type's component type.
+         */
+        using component_type = T;
+
+        /*!
+         * \brief  The number of planes in a `frustum`.
+         */
+        static constexpr int plane_count = 6;
+
+        /*!
+         * \brief  Default constructs each plane.
+         */
+        frustum() noexcept = default;
+
+        /*!
+         * \brief     Extracts the frustum of a view-projection matrix.
+         * \details   Clip coordinates are computed as `vec4(p, 1) * m` with
+         *            everything inside `-w <= x, y, z <= w` (e.g.,
+         *            `perspective_mat()` or `ortho_mat()` composed with a view
+         *            matrix).
+         *
+         * \param m   The view-projection matrix.
+         */
+        explicit frustum(const mat<T, 4, 4>& m) noexcept
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                this->planes_[2*i] = m[3] + m[i];
+                this->planes_[2*i + 1] = m[3] - m[i];
+            }
+
+            for (auto& plane : this->planes_)
+            {
+                const auto rlength = T(1) / tue::math::sqrt(
+                    plane[0]*plane[0] + plane[1]*plane[1] + plane[2]*plane[2]);
+                plane *= rlength;
+            }
+        }
+
+        /*!
+         * \brief     Returns a reference to the plane at the given index.
+         * \details   No bounds checking is performed.
+         *
+         * \param i   The index.
+         *
+         * \return    A reference to the plane at the given index.
+         */
+        const vec4<T>& plane(int i) const noexcept
+        {
+            return this->planes_[i];
+        }
+    };
+
+    /*!@}*/
+    namespace detail_
+    {
+        // Packs each lane's all-ones or all-zeros mask into one bit
+        template<int N>
+        inline std::uint8_t pack_visibility(
+            const simd<bool32, N>& visible) noexcept
+        {
+            alignas(simd<bool32, N>) bool32 lanes[N];
+            visible.store(lanes);
+
+            std::uint8_t bits = 0;
+            for (int j = 0; j < N; ++j)
+            {
+                bits |= std::uint8_t((lanes[j] & 1u) << j);
+            }
+
+            return bits;
+        }
+
+#ifdef TUE_SSE
+        inline std::uint8_t pack_visibility(
+            const simd<bool32, 4>& visible) noexcept
+        {
+            return std::uint8_t(_mm_movemask_ps(visible));
+        }
+
+        inline std::uint8_t pack_visibility(
+            const simd<bool32, 8>& visible) noexcept
+        {
+            alignas(simd<bool32, 8>) bool32 lanes[8];
+            visible.store(lanes);
+
+            const auto data = reinterpret_cast<const float*>(lanes);
+#ifdef TUE_AVX
+            return std::uint8_t(_mm256_movemask_ps(_mm256_load_ps(data)));
+#else
+            return std::uint8_t(_mm_movemask_ps(_mm_load_ps(data))
+                | (_mm_movemask_ps(_mm_load_ps(data + 4)) << 4));
+#endif
+        }
+#endif
+    }
+
+    namespace culling
+    {
+        /*!
+         * \addtogroup  frustum_hpp
+         * @{
+         */
+
+        /*!
+         * \brief          Tests `count` blocks of `N` bounding spheres
+         *                 against `f`.
+         * \details        A sphere is culled if it's entirely on the outside
+         *                 of any of the planes, which is conservative near
+         *                 the frustum's edges.
+         *
+         * \tparam N       The number of spheres per block. Must be at most
+         *                 8.
+         *
+         * \param f        The frustum.
+         * \param centers  A pointer to the blocks of sphere centers.
+         * \param radii    A pointer to the blocks of sphere radii.
+         * \param count    The number of blocks.
+         * \param visible  A pointer to where one byte per block will be
+         *                 stored. Bit `j` of each byte is set if sphere `j`
+         *                 of the block is visible.
+         */
+        template<int N>
+        inline void cull_spheres(
+            const frustum<float>& f,
+            const vec3<simd<float, N>>* centers,
+            const simd<float, N>* radii,
+            std::size_t count,
+            std::uint8_t* visible) noexcept
+        {
+            static_assert(N <= 8, "N must be at most 8");
+
+            using S = simd<float, N>;
+            vec4<S> planes[6];
+            for (int i = 0; i < 6; ++i)
+            {
+                planes[i] = vec4<S>(f.plane(i));
+            }
+
+            for (std::size_t b = 0; b < count; ++b)
+            {
+                const auto& c = centers[b];
+                const auto nr = -radii[b];
+                auto inside = simd<bool32, N>(true32);
+                for (const auto& p : planes)
+                {
+                    const auto d = c[0]*p[0] + c[1]*p[1] + c[2]*p[2] + p[3];
+                    inside &= tue::math::greater_equal(d, nr);
+                }
+
+                visible[b] = tue::detail_::pack_visibility(inside);
+            }
+        }
+
+        /*!
+         * \brief          Tests `count` blocks of `N` axis-aligned bounding
+         *                 boxes against `f`.
+         * \details        A box is culled if it's entirely on the outside of
+         *                 any of the planes, which is conservative near the
+         *                 frustum's edges.
+         *
+         * \tparam N       The number of boxes per block. Must be at most 8.
+         *
+         * \param f        The frustum.
+         * \param centers  A pointer to the blocks of box centers.
+         * \param extents  A pointer to the blocks of box half-extents.
+         * \param count    The number of blocks.
+         * \param visible  A pointer to where one byte per block will be
+         *                 stored. Bit `j` of each byte is set if box `j` of
+         *                 the block is visible.
+         */
+        template<int N>
+        inline void cull_aabbs(
+            const frustum<float>& f,
+            const vec3<simd<float, N>>* centers,
+            const vec3<simd<float, N>>* extents,
+            std::size_t count,
+            std::uint8_t* visible) noexcept
+        {
+            static_assert(N <= 8, "N must be at most 8");
+
+            using S = simd<float, N>;
+            vec4<S> planes[6];
+            vec3<S> abs_normals[6];
+            for (int i = 0; i < 6; ++i)
+            {
+                const auto& p = f.plane(i);
+                planes[i] = vec4<S>(p);
+                abs_normals[i] = vec3<S>(tue::math::abs(p.xyz()));
+            }
+
+            for (std::size_t b = 0; b < count; ++b)
+            {
+                const auto& c = centers[b];
+                const auto& e = extents[b];
+                auto inside = simd<bool32, N>(true32);
+                for (int i = 0; i < 6; ++i)
+                {
+                    const auto& p = planes[i];
+                    const auto& an = abs_normals[i];
+                    const auto d = c[0]*p[0] + c[1]*p[1] + c[2]*p[2] + p[3];
+                    const auto r = e[0]*an[0] + e[1]*an[1] + e[2]*an[2];
+                    inside &= tue::math::greater_equal(d, -r);
+                }
+
+                visible[b] = tue::detail_::pack_visibility(inside);
+            }
+        }
+
+        /*!@}*/
+    }
+}
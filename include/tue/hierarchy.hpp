@@ -0,0 +1,397 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "mat.hpp"
+#include "simd.hpp"
+#include "vec.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // Updates the n <= 8 non-root nodes starting at position i. Each
+        // node inherits its parent's dirty flag, and if none of them end up
+        // dirty nothing else is touched. Otherwise the parents' world
+        // matrices and the nodes' local matrices are gathered into the lanes
+        // of two mat<simd>'s, and all n are composed at once with
+        // math::affine_mult(). Lanes past n stay zero.
+        inline void propagate_block(
+            const int* parents, const mat<float, 4, 3>* locals,
+            mat<float, 4, 3>* worlds, std::uint8_t* dirty,
+            std::size_t i, std::size_t n) noexcept
+        {
+            using S = simd<float, 8>;
+
+            std::uint8_t any_dirty = 0;
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                dirty[i+j] |= dirty[parents[i+j]];
+                any_dirty |= dirty[i+j];
+            }
+
+            if (!any_dirty)
+            {
+                return;
+            }
+
+            auto p = mat<S, 4, 3>::zero();
+            auto l = mat<S, 4, 3>::zero();
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                const auto& parent = worlds[parents[i+j]];
+                const auto& local = locals[i+j];
+                for (int c = 0; c < 4; ++c)
+                {
+                    for (int r = 0; r < 3; ++r)
+                    {
+                        p[c][r].data()[j] = parent[c][r];
+                        l[c][r].data()[j] = local[c][r];
+                    }
+                }
+            }
+
+            const auto w = tue::math::affine_mult(p, l);
+
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                auto& world = worlds[i+j];
+                for (int c = 0; c < 4; ++c)
+                {
+                    for (int r = 0; r < 3; ++r)
+                    {
+                        world[c][r] = w[c][r].data()[j];
+                    }
+                }
+            }
+        }
+    }
+
+    /*!
+     * \defgroup  hierarchy_hpp <tue/hierarchy.hpp>
+     *
+     * \brief     The `hierarchy` class.
+     *
+     * @{
+     */
+
+    /*!
+     * \brief     A forest of nodes with local and world transforms.
+     * \details   Each node has a local transform relative to its parent (or
+     *            to the world, for roots) and a world transform, both stored
+     *            as `mat<float, 4, 3>`'s that transform points as
+     *            `m * vec4(p, 1)`. A node's world transform is
+     *            `math::affine_mult(parent_world, local)`.
+     *
+     *            Nodes are identified by the indices they were given at
+     *            construction, but are stored in breadth-first order, so each
+     *            level's nodes are contiguous and come after all of their
+     *            parents. `update()` computes the world transforms one level
+     *            at a time, 8 nodes at once, and skips every block of 8 that
+     *            has no dirty nodes and no children of dirty nodes.
+     *
+     *            To update on multiple threads, call `update_range()` on
+     *            disjoint ranges of each level in turn, with every range of a
+     *            level finished before any range of the next one starts, and
+     *            then call `clear_dirty()`. Ranges that start on a multiple
+     *            of 8 positions past `level_begin()` keep the blocks full.
+     */
+    class hierarchy
+    {
+        std::vector<std::size_t> order_;
+        std::vector<std::size_t> positions_;
+        std::vector<int> parents_;
+        std::vector<std::size_t> levels_;
+        std::vector<mat<float, 4, 3>> locals_;
+        std::vector<mat<float, 4, 3>> worlds_;
+        std::vector<std::uint8_t> dirty_;
+
+    public:
+        /*!
+         * \brief  Constructs an empty `hierarchy`.
+         */
+        hierarchy()
+        :
+            levels_(1, 0)
+        {
+        }
+
+        /*!
+         * \brief          Constructs a `hierarchy` with the given parents.
+         * \details        Every local and world transform starts out as the
+         *                 identity matrix, and no node is dirty.
+         *
+         * \param parents  The index of each node's parent, or a negative
+         *                 number for roots. Every node must be reachable
+         *                 from a root (i.e., there can't be any cycles).
+         * \param count    The number of nodes.
+         */
+        hierarchy(const int* parents, std::size_t count)
+        :
+            positions_(count),
+            parents_(count),
+            levels_(1, 0),
+            locals_(count, mat<float, 4, 3>::identity()),
+            worlds_(count, mat<float, 4, 3>::identity()),
+            dirty_(count, 0)
+        {
+            // Bucket each node's children so they can be visited in order
+            std::vector<std::size_t> child_offsets(count + 1, 0);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (parents[i] >= 0)
+                {
+                    ++child_offsets[std::size_t(parents[i]) + 1];
+                }
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                child_offsets[i+1] += child_offsets[i];
+            }
+
+            std::vector<std::size_t> children(child_offsets[count]);
+            auto next_child = child_offsets;
+            this->order_.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (parents[i] >= 0)
+                {
+                    children[next_child[std::size_t(parents[i])]++] = i;
+                }
+                else
+                {
+                    this->order_.push_back(i);
+                }
+            }
+
+            std::size_t begin = 0;
+            while (begin < this->order_.size())
+            {
+                const auto end = this->order_.size();
+                this->levels_.push_back(end);
+                for (auto k = begin; k < end; ++k)
+                {
+                    const auto node = this->order_[k];
+                    for (auto c = child_offsets[node];
+                        c < child_offsets[node+1]; ++c)
+                    {
+                        this->order_.push_back(children[c]);
+                    }
+                }
+
+                begin = end;
+            }
+
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                this->positions_[this->order_[k]] = k;
+            }
+
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                const auto parent = parents[this->order_[k]];
+                this->parents_[k] = parent < 0
+                    ? -1 : int(this->positions_[std::size_t(parent)]);
+            }
+        }
+
+        /*!
+         * \brief   Returns the number of nodes.
+         *
+         * \return  The number of nodes.
+         */
+        std::size_t size() const noexcept
+        {
+            return this->order_.size();
+        }
+
+        /*!
+         * \brief    Returns the number of levels.
+         * \details  Level 0 is every root, level 1 is every child of a
+         *           root, and so on.
+         *
+         * \return   The number of levels.
+         */
+        int level_count() const noexcept
+        {
+            return int(this->levels_.size()) - 1;
+        }
+
+        /*!
+         * \brief        Returns the position of a level's first node.
+         *
+         * \param level  The level.
+         *
+         * \return       The position of the level's first node.
+         */
+        std::size_t level_begin(int level) const noexcept
+        {
+            return this->levels_[std::size_t(level)];
+        }
+
+        /*!
+         * \brief        Returns one past the position of a level's last
+         *               node.
+         *
+         * \param level  The level.
+         *
+         * \return       One past the position of the level's last node.
+         */
+        std::size_t level_end(int level) const noexcept
+        {
+            return this->levels_[std::size_t(level) + 1];
+        }
+
+        /*!
+         * \brief        Returns a node's position in breadth-first order.
+         *
+         * \param node   The node's index.
+         *
+         * \return       The node's position.
+         */
+        std::size_t position(std::size_t node) const noexcept
+        {
+            return this->positions_[node];
+        }
+
+        /*!
+         * \brief        Returns the index of the node at a position.
+         *
+         * \param pos    The position.
+         *
+         * \return       The index of the node at the position.
+         */
+        std::size_t node(std::size_t pos) const noexcept
+        {
+            return this->order_[pos];
+        }
+
+        /*!
+         * \brief        Returns the position of the parent of the node at a
+         *               position.
+         *
+         * \param pos    The position.
+         *
+         * \return       The position of its parent, or -1 for roots.
+         */
+        int parent(std::size_t pos) const noexcept
+        {
+            return this->parents_[pos];
+        }
+
+        /*!
+         * \brief        Returns a node's local transform.
+         *
+         * \param node   The node's index.
+         *
+         * \return       The node's local transform.
+         */
+        const mat<float, 4, 3>& local(std::size_t node) const noexcept
+        {
+            return this->locals_[this->positions_[node]];
+        }
+
+        /*!
+         * \brief        Sets a node's local transform and marks it dirty.
+         *
+         * \param node   The node's index.
+         * \param m      The new local transform.
+         */
+        void set_local(std::size_t node, const mat<float, 4, 3>& m) noexcept
+        {
+            const auto pos = this->positions_[node];
+            this->locals_[pos] = m;
+            this->dirty_[pos] = 1;
+        }
+
+        /*!
+         * \brief        Returns a node's world transform as of the last
+         *               update.
+         *
+         * \param node   The node's index.
+         *
+         * \return       The node's world transform.
+         */
+        const mat<float, 4, 3>& world(std::size_t node) const noexcept
+        {
+            return this->worlds_[this->positions_[node]];
+        }
+
+        /*!
+         * \brief        Updates the world transforms of the nodes at
+         *               positions `[first, last)`.
+         * \details      The range must be within a single level, and every
+         *               previous level must already be updated. Dirty flags
+         *               are passed down from parents but not cleared.
+         *
+         * \param first  The position of the first node to update.
+         * \param last   One past the position of the last node to update.
+         */
+        void update_range(std::size_t first, std::size_t last) noexcept
+        {
+            if (first >= last)
+            {
+                return;
+            }
+
+            if (this->parents_[first] < 0)
+            {
+                for (auto i = first; i < last; ++i)
+                {
+                    if (this->dirty_[i])
+                    {
+                        this->worlds_[i] = this->locals_[i];
+                    }
+                }
+
+                return;
+            }
+
+            for (auto i = first; i < last; i += 8)
+            {
+                tue::detail_::propagate_block(
+                    this->parents_.data(), this->locals_.data(),
+                    this->worlds_.data(), this->dirty_.data(),
+                    i, last - i < 8 ? last - i : 8);
+            }
+        }
+
+        /*!
+         * \brief  Clears every node's dirty flag.
+         */
+        void clear_dirty() noexcept
+        {
+            std::fill(this->dirty_.begin(), this->dirty_.end(),
+                std::uint8_t(0));
+        }
+
+        /*!
+         * \brief  Updates the world transforms of every dirty node and its
+         *         descendants, and clears every dirty flag.
+         */
+        void update() noexcept
+        {
+            for (int level = 0; level < this->level_count(); ++level)
+            {
+                this->update_range(
+                    this->level_begin(level), this->level_end(level));
+            }
+
+            this->clear_dirty();
+        }
+    };
+
+    /*!@}*/
+}
@@ -0,0 +1,569 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "mat.hpp"
+#include "vec.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        struct lazy_vec_tag
+        {
+        };
+
+        struct lazy_mat_tag
+        {
+        };
+
+        template<typename T>
+        struct is_lazy_vec : std::is_base_of<lazy_vec_tag, T>
+        {
+        };
+
+        template<typename T>
+        struct is_lazy_mat : std::is_base_of<lazy_mat_tag, T>
+        {
+        };
+
+        template<typename T>
+        struct is_vec : std::false_type
+        {
+        };
+
+        template<typename T, int N>
+        struct is_vec<vec<T, N>> : std::true_type
+        {
+        };
+
+        template<typename T>
+        struct is_mat : std::false_type
+        {
+        };
+
+        template<typename T, int C, int R>
+        struct is_mat<mat<T, C, R>> : std::true_type
+        {
+        };
+
+        // Everything that can be combined component-wise with a lazy vector
+        // expression: other expressions, vec's, and scalars.
+        template<typename T>
+        struct is_lazy_vec_operand : std::integral_constant<bool,
+            is_lazy_vec<T>::value
+                || is_vec<T>::value
+                || is_vec_component<T>::value>
+        {
+        };
+
+        template<typename L, typename R>
+        struct is_lazy_vec_operation : std::integral_constant<bool,
+            (is_lazy_vec<L>::value && is_lazy_vec_operand<R>::value)
+                || (is_lazy_vec<R>::value && is_lazy_vec_operand<L>::value)>
+        {
+        };
+
+        template<typename L, typename R>
+        struct is_lazy_mat_operation : std::integral_constant<bool,
+            (is_lazy_mat<L>::value
+                && (is_lazy_mat<R>::value || is_mat<R>::value))
+            || (is_lazy_mat<R>::value && is_mat<L>::value)>
+        {
+        };
+
+        // Provides evaluation for every lazy vector expression E. E must
+        // have a static size and an operator[] computing one component.
+        template<typename E>
+        class lazy_vec_expr : public lazy_vec_tag
+        {
+        public:
+            auto eval() const noexcept
+            {
+                const auto& e = static_cast<const E&>(*this);
+                using T = std::decay_t<decltype(e[0])>;
+                vec<T, E::size> result;
+                for (int i = 0; i < E::size; ++i)
+                {
+                    result[i] = e[i];
+                }
+
+                return result;
+            }
+
+            template<typename T, int N>
+            operator vec<T, N>() const noexcept
+            {
+                static_assert(N == E::size, "size mismatch");
+                return vec<T, N>(this->eval());
+            }
+        };
+
+        template<typename T, int N>
+        class lazy_vec_ref : public lazy_vec_expr<lazy_vec_ref<T, N>>
+        {
+        public:
+            static constexpr int size = N;
+
+            explicit lazy_vec_ref(const vec<T, N>& v) noexcept
+            :
+                v_(v)
+            {
+            }
+
+            const T& operator[](int i) const noexcept
+            {
+                return v_[i];
+            }
+
+        private:
+            const vec<T, N>& v_;
+        };
+
+        // Holds the vec resulting from a matrix-vector product
+        template<typename T, int N>
+        class lazy_vec_value : public lazy_vec_expr<lazy_vec_value<T, N>>
+        {
+        public:
+            static constexpr int size = N;
+
+            explicit lazy_vec_value(const vec<T, N>& v) noexcept
+            :
+                v_(v)
+            {
+            }
+
+            const T& operator[](int i) const noexcept
+            {
+                return v_[i];
+            }
+
+        private:
+            vec<T, N> v_;
+        };
+
+        // A scalar operand, broadcast to every component. Its size of 0
+        // lets the other operand decide.
+        template<typename T>
+        class lazy_scalar
+        {
+        public:
+            static constexpr int size = 0;
+
+            explicit lazy_scalar(const T& x) noexcept
+            :
+                x_(x)
+            {
+            }
+
+            const T& operator[](int) const noexcept
+            {
+                return x_;
+            }
+
+        private:
+            T x_;
+        };
+
+        template<typename E>
+        inline std::enable_if_t<is_lazy_vec<E>::value, E>
+        lazy_vec_operand(const E& e) noexcept
+        {
+            return e;
+        }
+
+        template<typename T, int N>
+        inline lazy_vec_ref<T, N> lazy_vec_operand(const vec<T, N>& v) noexcept
+        {
+            return lazy_vec_ref<T, N>(v);
+        }
+
+        template<typename T>
+        inline std::enable_if_t<is_vec_component<T>::value, lazy_scalar<T>>
+        lazy_vec_operand(const T& x) noexcept
+        {
+            return lazy_scalar<T>(x);
+        }
+
+        template<typename T>
+        using lazy_vec_operand_t = decltype(
+            tue::detail_::lazy_vec_operand(std::declval<const T&>()));
+
+        struct lazy_add
+        {
+            template<typename T, typename U>
+            static auto apply(const T& lhs, const U& rhs) noexcept
+            {
+                return lhs + rhs;
+            }
+        };
+
+        struct lazy_subtract
+        {
+            template<typename T, typename U>
+            static auto apply(const T& lhs, const U& rhs) noexcept
+            {
+                return lhs - rhs;
+            }
+        };
+
+        struct lazy_multiply
+        {
+            template<typename T, typename U>
+            static auto apply(const T& lhs, const U& rhs) noexcept
+            {
+                return lhs * rhs;
+            }
+        };
+
+        struct lazy_divide
+        {
+            template<typename T, typename U>
+            static auto apply(const T& lhs, const U& rhs) noexcept
+            {
+                return lhs / rhs;
+            }
+        };
+
+        template<typename Op, typename L, typename R>
+        class lazy_vec_binary
+        :
+            public lazy_vec_expr<lazy_vec_binary<Op, L, R>>
+        {
+            static_assert(L::size == R::size || L::size == 0 || R::size == 0,
+                "size mismatch");
+
+        public:
+            static constexpr int size = L::size > R::size ? L::size : R::size;
+
+            lazy_vec_binary(const L& lhs, const R& rhs) noexcept
+            :
+                lhs_(lhs),
+                rhs_(rhs)
+            {
+            }
+
+            auto operator[](int i) const noexcept
+            {
+                return Op::apply(lhs_[i], rhs_[i]);
+            }
+
+        private:
+            L lhs_;
+            R rhs_;
+        };
+
+        template<typename E>
+        class lazy_vec_negate : public lazy_vec_expr<lazy_vec_negate<E>>
+        {
+        public:
+            static constexpr int size = E::size;
+
+            explicit lazy_vec_negate(const E& e) noexcept
+            :
+                e_(e)
+            {
+            }
+
+            auto operator[](int i) const noexcept
+            {
+                return -e_[i];
+            }
+
+        private:
+            E e_;
+        };
+
+        template<typename Op, typename L, typename R>
+        using lazy_vec_binary_t = lazy_vec_binary<
+            Op, lazy_vec_operand_t<L>, lazy_vec_operand_t<R>>;
+
+        template<typename Op, typename L, typename R>
+        inline lazy_vec_binary_t<Op, L, R>
+        lazy_vec_binary_operation(const L& lhs, const R& rhs) noexcept
+        {
+            return lazy_vec_binary_t<Op, L, R>(
+                tue::detail_::lazy_vec_operand(lhs),
+                tue::detail_::lazy_vec_operand(rhs));
+        }
+
+        template<typename L, typename R>
+        inline std::enable_if_t<
+            is_lazy_vec_operation<L, R>::value,
+            lazy_vec_binary_t<lazy_add, L, R>>
+        operator+(const L& lhs, const R& rhs) noexcept
+        {
+            return tue::detail_::lazy_vec_binary_operation<lazy_add>(
+                lhs, rhs);
+        }
+
+        template<typename L, typename R>
+        inline std::enable_if_t<
+            is_lazy_vec_operation<L, R>::value,
+            lazy_vec_binary_t<lazy_subtract, L, R>>
+        operator-(const L& lhs, const R& rhs) noexcept
+        {
+            return tue::detail_::lazy_vec_binary_operation<lazy_subtract>(
+                lhs, rhs);
+        }
+
+        template<typename L, typename R>
+        inline std::enable_if_t<
+            is_lazy_vec_operation<L, R>::value,
+            lazy_vec_binary_t<lazy_multiply, L, R>>
+        operator*(const L& lhs, const R& rhs) noexcept
+        {
+            return tue::detail_::lazy_vec_binary_operation<lazy_multiply>(
+                lhs, rhs);
+        }
+
+        template<typename L, typename R>
+        inline std::enable_if_t<
+            is_lazy_vec_operation<L, R>::value,
+            lazy_vec_binary_t<lazy_divide, L, R>>
+        operator/(const L& lhs, const R& rhs) noexcept
+        {
+            return tue::detail_::lazy_vec_binary_operation<lazy_divide>(
+                lhs, rhs);
+        }
+
+        template<typename E>
+        inline std::enable_if_t<is_lazy_vec<E>::value, lazy_vec_negate<E>>
+        operator-(const E& e) noexcept
+        {
+            return lazy_vec_negate<E>(e);
+        }
+
+        template<typename E>
+        inline std::enable_if_t<is_lazy_vec<E>::value, E>
+        operator+(const E& e) noexcept
+        {
+            return e;
+        }
+
+        // Lazy matrix expressions are products of mat's. They're multiplied
+        // into a vector one factor at a time (from the right for column
+        // vectors and from the left for row vectors) so no matrix-matrix
+        // product is ever computed.
+        template<typename T, int C, int R>
+        class lazy_mat_ref : public lazy_mat_tag
+        {
+        public:
+            explicit lazy_mat_ref(const mat<T, C, R>& m) noexcept
+            :
+                m_(m)
+            {
+            }
+
+            const mat<T, C, R>& eval() const noexcept
+            {
+                return m_;
+            }
+
+            template<typename V>
+            auto multiply_vec(const V& v) const noexcept
+            {
+                return m_ * v;
+            }
+
+            template<typename V>
+            auto vec_multiply(const V& v) const noexcept
+            {
+                return v * m_;
+            }
+
+        private:
+            const mat<T, C, R>& m_;
+        };
+
+        template<typename L, typename R>
+        class lazy_mat_product : public lazy_mat_tag
+        {
+        public:
+            lazy_mat_product(const L& lhs, const R& rhs) noexcept
+            :
+                lhs_(lhs),
+                rhs_(rhs)
+            {
+            }
+
+            auto eval() const noexcept
+            {
+                return lhs_.eval() * rhs_.eval();
+            }
+
+            template<typename T, int C, int N>
+            operator mat<T, C, N>() const noexcept
+            {
+                return mat<T, C, N>(this->eval());
+            }
+
+            template<typename V>
+            auto multiply_vec(const V& v) const noexcept
+            {
+                return lhs_.multiply_vec(rhs_.multiply_vec(v));
+            }
+
+            template<typename V>
+            auto vec_multiply(const V& v) const noexcept
+            {
+                return rhs_.vec_multiply(lhs_.vec_multiply(v));
+            }
+
+        private:
+            L lhs_;
+            R rhs_;
+        };
+
+        template<typename E>
+        inline std::enable_if_t<is_lazy_mat<E>::value, E>
+        lazy_mat_operand(const E& e) noexcept
+        {
+            return e;
+        }
+
+        template<typename T, int C, int R>
+        inline lazy_mat_ref<T, C, R> lazy_mat_operand(
+            const mat<T, C, R>& m) noexcept
+        {
+            return lazy_mat_ref<T, C, R>(m);
+        }
+
+        template<typename T>
+        using lazy_mat_operand_t = decltype(
+            tue::detail_::lazy_mat_operand(std::declval<const T&>()));
+
+        template<typename T, int N>
+        inline const vec<T, N>& lazy_eval_vec(const vec<T, N>& v) noexcept
+        {
+            return v;
+        }
+
+        template<typename E>
+        inline auto lazy_eval_vec(const E& e) noexcept
+        {
+            return e.eval();
+        }
+
+        template<typename V>
+        inline auto lazy_vec_result(const V& v) noexcept
+        {
+            return lazy_vec_value<
+                typename V::component_type, V::component_count>(v);
+        }
+
+        template<typename L, typename R>
+        inline std::enable_if_t<
+            is_lazy_mat_operation<L, R>::value,
+            lazy_mat_product<lazy_mat_operand_t<L>, lazy_mat_operand_t<R>>>
+        operator*(const L& lhs, const R& rhs) noexcept
+        {
+            return {
+                tue::detail_::lazy_mat_operand(lhs),
+                tue::detail_::lazy_mat_operand(rhs),
+            };
+        }
+
+        // These use deduced return types, so they're constrained by a
+        // template parameter instead.
+        template<typename L, typename V, std::enable_if_t<
+            is_lazy_mat<L>::value
+                && (is_lazy_vec<V>::value || is_vec<V>::value),
+            int> = 0>
+        inline auto operator*(const L& lhs, const V& rhs) noexcept
+        {
+            return tue::detail_::lazy_vec_result(lhs.multiply_vec(
+                tue::detail_::lazy_eval_vec(rhs)));
+        }
+
+        template<typename V, typename R, std::enable_if_t<
+            (is_lazy_vec<V>::value || is_vec<V>::value)
+                && is_lazy_mat<R>::value,
+            int> = 0>
+        inline auto operator*(const V& lhs, const R& rhs) noexcept
+        {
+            return tue::detail_::lazy_vec_result(rhs.vec_multiply(
+                tue::detail_::lazy_eval_vec(lhs)));
+        }
+    }
+
+    /*!
+     * \defgroup  lazy_hpp <tue/lazy.hpp>
+     *
+     * \brief     Opt-in lazy evaluation of `vec` and `mat` expressions.
+     * \details   Every `vec` and `mat` operator returns a fully computed
+     *            result, so `a*s + b*t - c` computes two temporary `vec`'s
+     *            before the final one, and `p * v * m * x` computes two
+     *            matrix-matrix products before the matrix-vector one. Wrapping
+     *            an operand in `tue::lazy()` makes the operators build an
+     *            expression instead:
+     *
+     *            - Component-wise `+`, `-`, `*`, and `/` between lazy vector
+     *              expressions, `vec`'s, and scalars are fused and computed
+     *              in one pass, one component at a time, when the expression
+     *              is converted to a `vec` (or its `eval()` is called).
+     *            - Products of lazy matrices and `mat`'s are deferred. When
+     *              one is multiplied by a column vector on the right (or a
+     *              row vector on the left), the vector is multiplied by each
+     *              factor in turn, e.g., `lazy(p) * v * m * x` is computed as
+     *              `p * (v * (m * x))`. Otherwise, they're multiplied left to
+     *              right when converted to a `mat`.
+     *
+     *            \code
+     *            const vec3<float32x8> r = lazy(a) * s + lazy(b) * t - c;
+     *            const fvec4 y = lazy(p) * v * m * x;
+     *            \endcode
+     *
+     *            Note that `b * t` without `lazy()` would still be computed
+     *            eagerly since neither of its operands is lazy. Expressions
+     *            refer to the `vec`'s and `mat`'s they're built from instead
+     *            of copying them, so don't store one in an `auto` variable
+     *            that outlives its operands.
+     * @{
+     */
+
+    /*!
+     * \brief     Starts a lazy vector expression.
+     *
+     * \tparam T  The component type of `v`.
+     * \tparam N  The component count of `v`.
+     *
+     * \param v   The `vec` to refer to.
+     *
+     * \return    A lazy vector expression referring to `v`.
+     */
+    template<typename T, int N>
+    inline tue::detail_::lazy_vec_ref<T, N> lazy(const vec<T, N>& v) noexcept
+    {
+        return tue::detail_::lazy_vec_ref<T, N>(v);
+    }
+
+    /*!
+     * \brief     Starts a lazy matrix expression.
+     *
+     * \tparam T  The component type of `m`.
+     * \tparam C  The column count of `m`.
+     * \tparam R  The row count of `m`.
+     *
+     * \param m   The `mat` to refer to.
+     *
+     * \return    A lazy matrix expression referring to `m`.
+     */
+    template<typename T, int C, int R>
+    inline tue::detail_::lazy_mat_ref<T, C, R> lazy(
+        const mat<T, C, R>& m) noexcept
+    {
+        return tue::detail_::lazy_mat_ref<T, C, R>(m);
+    }
+
+    /*!@}*/
+}
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -824,7 +826,10 @@ namespace tue
 #include "detail_/mat2xR.hpp"
 #include "detail_/mat3xR.hpp"
 #include "detail_/mat4xR.hpp"
+#include "detail_/matdecomp.hpp"
+#include "detail_/matinv.hpp"
 #include "detail_/matmult.hpp"
+#include "detail_/mattranspose.hpp"
 
 #define shift_left <<
 #define shift_right >> // Because ">>" inside template args confuses Doxygen
@@ -1098,6 +1103,8 @@ namespace tue
     /*!
      * \brief      Computes the matrix product of `lhs` and `rhs`.
      * \details    `rhs` is treated like a matrix with a single column.
+     *             See `tue::math::simd_mult()` for a version that uses SIMD
+     *             instructions for `float` and `double` components.
      *
      * \tparam T   The component type of `lhs`.
      * \tparam U   The component type of `rhs`.
@@ -1120,7 +1127,9 @@ namespace tue
     /*!
      * \brief      Computes the matrix product of `lhs` and `rhs`.
      * \details    To compute the component-wise product, use
-     *             `tue::math::comp_mult()` instead.
+     *             `tue::math::comp_mult()` instead. See
+     *             `tue::math::simd_mult()` for a version that uses SIMD
+     *             instructions for `float` and `double` components.
      *
      * \tparam T   The component type of `lhs`.
      * \tparam U   The component type of `rhs`.
@@ -1659,6 +1668,52 @@ namespace tue
         return tue::detail_::inequality_operator_mm(lhs, rhs);
     }
 
+    /*!
+     * \brief     Packs `N` `mat`'s into one `mat` of `simd` components.
+     * \details   Lane `i` of each component of the result is the
+     *            corresponding component of `ms[i]`. Packing
+     *            `mat4x4<float>`'s into a `mat4x4<float32x4>` uses SSE
+     *            shuffles when `TUE_SSE` is defined, and packing them into a
+     *            `mat4x4<float32x8>` uses AVX shuffles when `TUE_AVX` is
+     *            defined.
+     *
+     * \tparam N  The number of `mat`'s to pack.
+     * \tparam T  The component type of the `mat`'s to pack.
+     * \tparam C  The column count of the `mat`'s to pack.
+     * \tparam R  The row count of the `mat`'s to pack.
+     *
+     * \param ms  A pointer to the `N` `mat`'s to pack.
+     *
+     * \return    The packed `mat`.
+     */
+    template<int N, typename T, int C, int R>
+    inline mat<simd<T, N>, C, R> pack_mats(const mat<T, C, R>* ms) noexcept
+    {
+        mat<simd<T, N>, C, R> result;
+        tue::detail_::pack_mats_m(ms, result);
+        return result;
+    }
+
+    /*!
+     * \brief     Unpacks a `mat` of `simd` components into `N` `mat`'s.
+     * \details   This is the inverse of `pack_mats()`.
+     *
+     * \tparam T  The `simd` component type of `m`.
+     * \tparam N  The `simd` component count of `m`.
+     * \tparam C  The column count of `m`.
+     * \tparam R  The row count of `m`.
+     *
+     * \param m   The `mat` to unpack.
+     * \param ms  A pointer to where the `N` unpacked `mat`'s will be
+     *            stored.
+     */
+    template<typename T, int N, int C, int R>
+    inline void unpack_mats(
+        const mat<simd<T, N>, C, R>& m, mat<T, C, R>* ms) noexcept
+    {
+        tue::detail_::unpack_mats_m(m, ms);
+    }
+
     /*!@}*/
     namespace math
     {
@@ -2110,8 +2165,65 @@ namespace tue
             return tue::detail_::comp_mult_mm(lhs, rhs);
         }
 
+        /*!
+         * \brief      Computes the matrix product of `lhs` and `rhs` with
+         *             SIMD instructions when possible.
+         * \details    The result is the same as `lhs * rhs`. When `T` is
+         *             `float` (with `TUE_SSE`) or `double` (with `TUE_SSE2`)
+         *             and `lhs` has 3 or 4 rows, each column of `lhs` is
+         *             loaded into a `simd<T, 4>` and `rhs` is multiplied as a
+         *             sum of scaled columns. Unlike `operator*()`, this can't
+         *             be used in a constant expression.
+         *
+         * \tparam T   The component type of both `lhs` and `rhs`.
+         * \tparam N   The column count of `lhs` and component count of
+         *             `rhs`.
+         * \tparam R   The row count of `lhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     The matrix product of `lhs` and `rhs`.
+         */
+        template<typename T, int N, int R>
+        inline vec<T, R>
+        simd_mult(const mat<T, N, R>& lhs, const vec<T, N>& rhs) noexcept
+        {
+            return tue::detail_::simd_mult_mv(lhs, rhs);
+        }
+
+        /*!
+         * \brief      Computes the matrix product of `lhs` and `rhs` with
+         *             SIMD instructions when possible.
+         * \details    The result is the same as `lhs * rhs`. When `T` is
+         *             `float` (with `TUE_SSE`) or `double` (with `TUE_SSE2`)
+         *             and `lhs` has 3 or 4 rows, each column of `lhs` is
+         *             loaded into a `simd<T, 4>` and each column of the
+         *             result is a sum of them scaled by the components of a
+         *             column of `rhs`. Unlike `operator*()`, this can't be
+         *             used in a constant expression.
+         *
+         * \tparam T   The component type of both `lhs` and `rhs`.
+         * \tparam C   The column count of `rhs`.
+         * \tparam N   The column count of `lhs` and row count of `rhs`.
+         * \tparam R   The row count of `lhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     The matrix product of `lhs` and `rhs`.
+         */
+        template<typename T, int C, int N, int R>
+        inline mat<T, C, R>
+        simd_mult(const mat<T, N, R>& lhs, const mat<T, C, N>& rhs) noexcept
+        {
+            return tue::detail_::simd_mult_mm(lhs, rhs);
+        }
+
         /*!
          * \brief     Computes the transpose of `m`.
+         * \details   See `simd_transpose()` for a version that uses SIMD
+         *            shuffles.
          *
          * \tparam T  The component type of `m`.
          * \tparam C  The column count of `m`.
@@ -2129,6 +2241,418 @@ namespace tue
             return tue::detail_::transpose_m(m);
         }
 
+        /*!
+         * \brief     Computes the transpose of `m` with SIMD shuffles when
+         *            possible.
+         * \details   The result is the same as `transpose()`.
+         *            `mat4x4<float>`'s are transposed with SSE shuffles when
+         *            `TUE_SSE` is defined, and every other shape uses the
+         *            generic transpose. Unlike `transpose()`, this can't be
+         *            used in a constant expression.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    The transpose of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, R, C> simd_transpose(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::simd_transpose_m(m);
+        }
+
+        /*!
+         * \brief     Computes the determinant of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A square `mat`.
+         *
+         * \return    The determinant of `m`.
+         */
+        template<typename T, int N>
+        inline constexpr T determinant(const mat<T, N, N>& m) noexcept
+        {
+            return tue::detail_::determinant_m(m);
+        }
+
+        /*!
+         * \brief     Computes the inverse of `m`.
+         * \details   `m` must be invertible (i.e., its determinant must not be
+         *            `0`). `T` can be a `simd` type to invert several matrices
+         *            at once. See `simd_inverse()` for a version that uses SSE
+         *            when possible.
+         *
+         * \tparam T  The component type of `m`. Must be a floating-point type
+         *            or a floating-point `simd` type.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A square `mat`.
+         *
+         * \return    The inverse of `m`.
+         */
+        template<typename T, int N>
+        inline constexpr mat<T, N, N> inverse(const mat<T, N, N>& m) noexcept
+        {
+            return tue::detail_::inverse_m(m);
+        }
+
+        /*!
+         * \brief     Computes the inverse of `m` with SSE when possible.
+         * \details   The result is the same as `inverse()` up to rounding.
+         *            `mat4x4<float>`'s are inverted with SSE shuffles when
+         *            `TUE_SSE` is defined, and every other type uses the
+         *            generic inverse. Unlike `inverse()`, this can't be used
+         *            in a constant expression.
+         *
+         * \tparam T  The component type of `m`. Must be a floating-point type
+         *            or a floating-point `simd` type.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A square `mat`. Must be invertible.
+         *
+         * \return    The inverse of `m`.
+         */
+        template<typename T, int N>
+        inline mat<T, N, N> simd_inverse(const mat<T, N, N>& m) noexcept
+        {
+            return tue::detail_::simd_inverse_m(m);
+        }
+
+        /*!
+         * \brief     Computes the inverse of an affine transformation matrix.
+         * \details   This is cheaper than `inverse()` since only the upper-left
+         *            3x3 part needs a general inverse. A `mat<T, 3, 4>` or
+         *            `mat<T, 4, 4>` must be of the form generated by
+         *            `tue::transform` (i.e., with the translation in the last
+         *            row and, for a `mat<T, 4, 4>`, a last column of
+         *            `[0, 0, 0, 1]`). A `mat<T, 4, 3>` is its transpose, with
+         *            the translation in the last column.
+         *
+         * \tparam T  The component type of `m`. Must be a floating-point type
+         *            or a floating-point `simd` type.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   An invertible affine transformation matrix.
+         *
+         * \return    The inverse of `m`.
+         */
+        template<typename T, int C, int R>
+        inline constexpr std::enable_if_t<
+            (C == 3 && R == 4) || (C == 4 && R == 3) || (C == 4 && R == 4),
+            mat<T, C, R>>
+        inverse_affine(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::inverse_affine_m(
+                m, tue::detail_::inverse_m(mat<T, 3, 3>(m)));
+        }
+
+        /*!
+         * \brief      Computes the product of two compact affine
+         *             transformation matrices.
+         * \details    A `mat<T, 3, 4>` stores an affine transformation as
+         *             generated by `tue::transform` without the constant last
+         *             column of `[0, 0, 0, 1]`, saving a quarter of the memory
+         *             of a `mat<T, 4, 4>`. A `mat<T, 4, 3>` is its transpose,
+         *             without the constant last row. Either converts to and
+         *             from a `mat<T, 4, 4>` with the usual `mat` conversion
+         *             constructors, and the result is the same as converting
+         *             both operands to `mat<T, 4, 4>`'s, multiplying them, and
+         *             converting back.
+         *
+         * \tparam T   The component type of both `lhs` and `rhs`.
+         * \tparam C   The column count of both `lhs` and `rhs`.
+         * \tparam R   The row count of both `lhs` and `rhs`.
+         *
+         * \param lhs  The left-hand side operand.
+         * \param rhs  The right-hand side operand.
+         *
+         * \return     The product of `lhs` and `rhs`.
+         */
+        template<typename T, int C, int R>
+        inline constexpr std::enable_if_t<
+            (C == 3 && R == 4) || (C == 4 && R == 3),
+            mat<T, C, R>>
+        affine_mult(const mat<T, C, R>& lhs, const mat<T, C, R>& rhs) noexcept
+        {
+            return tue::detail_::affine_mult_m(lhs, rhs);
+        }
+
+        /*!
+         * \brief     Computes the inverse of a rigid transformation matrix.
+         * \details   A rigid transformation is a rotation followed by a
+         *            translation, so the inverse of its rotation part is just
+         *            its transpose. Otherwise, this is the same as
+         *            `inverse_affine()`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A rigid transformation matrix.
+         *
+         * \return    The inverse of `m`.
+         */
+        template<typename T, int C, int R>
+        inline constexpr std::enable_if_t<
+            (C == 3 && R == 4) || (C == 4 && R == 3) || (C == 4 && R == 4),
+            mat<T, C, R>>
+        inverse_rigid(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::inverse_affine_m(
+                m, tue::detail_::transpose_m(mat<T, 3, 3>(m)));
+        }
+
+        /*!
+         * \brief              Computes the eigenvalues and eigenvectors of a
+         *                     symmetric 3x3 matrix.
+         * \details            Uses a fixed number of cyclic Jacobi sweeps
+         *                     without any branches, so `T` can be a `simd`
+         *                     type to decompose several matrices at once
+         *                     (e.g., the inertia tensors or covariance
+         *                     matrices of 4 or 8 bodies).
+         *                     <br/>
+         *                     The eigenvalues are sorted from largest to
+         *                     smallest and `eigenvectors[i]` is the unit
+         *                     eigenvector for `eigenvalues[i]`. The
+         *                     eigenvectors are orthonormal, so `m` equals
+         *                     `eigenvectors * diagonal * transpose(
+         *                     eigenvectors)` where `diagonal` is the diagonal
+         *                     matrix of `eigenvalues`.
+         *
+         * \tparam T           The component type of `m`. Must be a
+         *                     floating-point type or a floating-point `simd`
+         *                     type.
+         *
+         * \param m            A symmetric 3x3 matrix.
+         * \param eigenvalues  Where the eigenvalues will be stored.
+         * \param eigenvectors Where the eigenvectors will be stored.
+         */
+        template<typename T>
+        inline void eigen_symmetric(
+            const mat<T, 3, 3>& m,
+            vec3<T>& eigenvalues, mat<T, 3, 3>& eigenvectors) noexcept
+        {
+            tue::detail_::eigen_symmetric_m(m, eigenvalues, eigenvectors);
+        }
+
+        /*!
+         * \brief     Computes the singular value decomposition of a 3x3
+         *            matrix.
+         * \details   `m` equals `u * diagonal * transpose(v)` where `diagonal`
+         *            is the diagonal matrix of `s`. Both `u` and `v` are
+         *            rotations (i.e., their determinants are `1`), so if the
+         *            determinant of `m` is negative (e.g., an inverted finite
+         *            element), the last singular value is negative instead.
+         *            The singular values are sorted from largest to smallest
+         *            magnitude.
+         *            <br/>
+         *            `v` is found with `eigen_symmetric()` and `u` and `s`
+         *            with Givens rotations, all without branches, so `T` can
+         *            be a `simd` type to decompose several matrices at once.
+         *            Singular values much smaller than the largest one lose
+         *            precision since `transpose(m) * m` is decomposed first.
+         *
+         * \tparam T  The component type of `m`. Must be a floating-point type
+         *            or a floating-point `simd` type.
+         *
+         * \param m   A 3x3 matrix.
+         * \param u   Where the left singular vectors will be stored.
+         * \param s   Where the singular values will be stored.
+         * \param v   Where the right singular vectors will be stored.
+         */
+        template<typename T>
+        inline void svd(
+            const mat<T, 3, 3>& m,
+            mat<T, 3, 3>& u, vec3<T>& s, mat<T, 3, 3>& v) noexcept
+        {
+            tue::detail_::svd_m(m, u, s, v);
+        }
+
+        /*!
+         * \brief     Computes the polar decomposition of a 3x3 matrix.
+         * \details   `m` equals `r * s` where `r` is a rotation and `s` is
+         *            symmetric. Like with `svd()`, which this is computed
+         *            from, `s` has a negative eigenvalue if the determinant of
+         *            `m` is negative, and `T` can be a `simd` type to
+         *            decompose several matrices at once.
+         *
+         * \tparam T  The component type of `m`. Must be a floating-point type
+         *            or a floating-point `simd` type.
+         *
+         * \param m   A 3x3 matrix.
+         * \param r   Where the rotation will be stored.
+         * \param s   Where the symmetric stretch will be stored.
+         */
+        template<typename T>
+        inline void polar_decompose(
+            const mat<T, 3, 3>& m, mat<T, 3, 3>& r, mat<T, 3, 3>& s) noexcept
+        {
+            mat<T, 3, 3> u, v;
+            vec3<T> sigma;
+            tue::detail_::svd_m(m, u, sigma, v);
+
+            const auto vt = tue::detail_::transpose_m(v);
+            r = u * vt;
+            s = mat<T, 3, 3>(v[0] * sigma[0], v[1] * sigma[1], v[2] * sigma[2])
+                * vt;
+        }
+
+        /*!
+         * \brief     Solves `m * x = b` for `x` with a Cholesky decomposition.
+         * \details   `m` must be symmetric positive-definite. Only its lower
+         *            triangle (i.e., `m[c][r]` where `r >= c`) is read. There
+         *            are no branches, so `T` can be a `simd` type to solve
+         *            several systems at once.
+         *
+         * \tparam T  The component type of `m` and `b`. Must be a
+         *            floating-point type or a floating-point `simd` type.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A symmetric positive-definite matrix.
+         * \param b   The right-hand side.
+         *
+         * \return    The solution `x`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> solve_cholesky(
+            const mat<T, N, N>& m, const vec<T, N>& b) noexcept
+        {
+            vec<T, N> x;
+            tue::detail_::solve_cholesky_m<T, N>(m, b, x);
+            return x;
+        }
+
+        /*!
+         * \brief     Solves `m * x = b` for `x` like `solve_cholesky()`, but
+         *            with `m`, `b`, and `x` in plain arrays.
+         * \details   For systems bigger than `mat` supports (e.g., 6x6).
+         *            `m[c][r]` is the component in column `c` and row `r`,
+         *            the same as with a `mat`.
+         *
+         * \tparam T  The component type of `m` and `b`. Must be a
+         *            floating-point type or a floating-point `simd` type.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A symmetric positive-definite matrix.
+         * \param b   The right-hand side.
+         *
+         * \return    The solution `x`.
+         */
+        template<typename T, std::size_t N>
+        inline std::array<T, N> solve_cholesky(
+            const T (&m)[N][N], const T (&b)[N]) noexcept
+        {
+            std::array<T, N> x;
+            tue::detail_::solve_cholesky_m<T, int(N)>(m, b, x);
+            return x;
+        }
+
+        /*!
+         * \brief     Solves `m * x = b` for `x` with an LDLT decomposition.
+         * \details   Like `solve_cholesky()` but without square roots, so `m`
+         *            only has to be symmetric with nonzero leading principal
+         *            minors (e.g., it can be indefinite). Only its lower
+         *            triangle is read.
+         *
+         * \tparam T  The component type of `m` and `b`. Must be a
+         *            floating-point type or a floating-point `simd` type.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A symmetric matrix.
+         * \param b   The right-hand side.
+         *
+         * \return    The solution `x`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> solve_ldlt(
+            const mat<T, N, N>& m, const vec<T, N>& b) noexcept
+        {
+            vec<T, N> x;
+            tue::detail_::solve_ldlt_m<T, N>(m, b, x);
+            return x;
+        }
+
+        /*!
+         * \brief     Solves `m * x = b` for `x` like `solve_ldlt()`, but
+         *            with `m`, `b`, and `x` in plain arrays.
+         * \details   For systems bigger than `mat` supports (e.g., 6x6).
+         *            `m[c][r]` is the component in column `c` and row `r`,
+         *            the same as with a `mat`.
+         *
+         * \tparam T  The component type of `m` and `b`. Must be a
+         *            floating-point type or a floating-point `simd` type.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A symmetric matrix.
+         * \param b   The right-hand side.
+         *
+         * \return    The solution `x`.
+         */
+        template<typename T, std::size_t N>
+        inline std::array<T, N> solve_ldlt(
+            const T (&m)[N][N], const T (&b)[N]) noexcept
+        {
+            std::array<T, N> x;
+            tue::detail_::solve_ldlt_m<T, int(N)>(m, b, x);
+            return x;
+        }
+
+        /*!
+         * \brief     Solves `m * x = b` for `x` with an LU decomposition.
+         * \details   There's no pivoting (so there are no branches and `T`
+         *            can be a `simd` type to solve several systems at once),
+         *            so the leading principal minors of `m` must be nonzero
+         *            (e.g., `m` can be diagonally dominant).
+         *
+         * \tparam T  The component type of `m` and `b`. Must be a
+         *            floating-point type or a floating-point `simd` type.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A square matrix.
+         * \param b   The right-hand side.
+         *
+         * \return    The solution `x`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> solve_lu(
+            const mat<T, N, N>& m, const vec<T, N>& b) noexcept
+        {
+            vec<T, N> x;
+            tue::detail_::solve_lu_m<T, N>(m, b, x);
+            return x;
+        }
+
+        /*!
+         * \brief     Solves `m * x = b` for `x` like `solve_lu()`, but
+         *            with `m`, `b`, and `x` in plain arrays.
+         * \details   For systems bigger than `mat` supports (e.g., 6x6).
+         *            `m[c][r]` is the component in column `c` and row `r`,
+         *            the same as with a `mat`.
+         *
+         * \tparam T  The component type of `m` and `b`. Must be a
+         *            floating-point type or a floating-point `simd` type.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A square matrix.
+         * \param b   The right-hand side.
+         *
+         * \return    The solution `x`.
+         */
+        template<typename T, std::size_t N>
+        inline std::array<T, N> solve_lu(
+            const T (&m)[N][N], const T (&b)[N]) noexcept
+        {
+            std::array<T, N> x;
+            tue::detail_::solve_lu_m<T, int(N)>(m, b, x);
+            return x;
+        }
+
         /*!@}*/
     }
 }
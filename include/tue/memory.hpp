@@ -0,0 +1,408 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+/*!
+ * \defgroup  memory_hpp <tue/memory.hpp>
+ *
+ * \brief     The `aligned_allocator` class template, the `simd_arena` class,
+ *            and their associated utility functions.
+ */
+namespace tue
+{
+    namespace detail_
+    {
+        inline constexpr bool is_pow2(std::size_t x) noexcept
+        {
+            return x != 0 && (x & (x - 1)) == 0;
+        }
+
+        inline std::uintptr_t align_up(
+            std::uintptr_t address, std::size_t alignment) noexcept
+        {
+            return (address + (alignment - 1))
+                & ~static_cast<std::uintptr_t>(alignment - 1);
+        }
+
+        inline void* aligned_malloc(
+            std::size_t size, std::size_t alignment) noexcept
+        {
+            // The original pointer is stashed immediately before the aligned
+            // block so aligned_free() can recover it without a side table.
+            const auto padding = alignment - 1 + sizeof(void*);
+            if (size > std::numeric_limits<std::size_t>::max() - padding)
+            {
+                return nullptr;
+            }
+
+            void* const original = std::malloc(size + padding);
+            if (original == nullptr)
+            {
+                return nullptr;
+            }
+
+            const auto aligned = tue::detail_::align_up(
+                reinterpret_cast<std::uintptr_t>(original) + sizeof(void*),
+                alignment);
+
+            reinterpret_cast<void**>(aligned)[-1] = original;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        inline void aligned_free(void* p) noexcept
+        {
+            if (p != nullptr)
+            {
+                std::free(static_cast<void**>(p)[-1]);
+            }
+        }
+    }
+
+    /*!
+     * \addtogroup  memory_hpp
+     * @{
+     */
+
+    /*!
+     * \brief             A standard library compatible allocator which
+     *                    allocates memory aligned to at least `Alignment`
+     *                    bytes.
+     * \details           The default allocator isn't required to honor
+     *                    alignments greater than `alignof(std::max_align_t)`
+     *                    before C++17, which `simd` types (and the `vec`,
+     *                    `quat`, and `mat` types built from them) regularly
+     *                    exceed. Use this allocator for containers of such
+     *                    types, e.g.,
+     *                    `std::vector<float32x8, aligned_allocator<float32x8>>`.
+     *
+     * \tparam T          The allocated type.
+     * \tparam Alignment  The minimum alignment (in bytes). Must be a power of
+     *                    two. The effective alignment is the greater of
+     *                    `Alignment` and `alignof(T)`.
+     */
+    template<typename T, std::size_t Alignment = alignof(T)>
+    class aligned_allocator
+    {
+        static_assert(tue::detail_::is_pow2(Alignment),
+            "Alignment must be a power of two");
+
+    public:
+        /*!
+         * \brief  The allocated type.
+         */
+        using value_type = T;
+
+        /*!
+         * \brief  The effective alignment (in bytes) of allocated memory.
+         */
+        static constexpr std::size_t alignment =
+            Alignment > alignof(T) ? Alignment : alignof(T);
+
+        /*!
+         * \brief     Rebinds this allocator type to another value type.
+         *
+         * \tparam U  The new value type.
+         */
+        template<typename U>
+        struct rebind
+        {
+            /*!
+             * \brief  The rebound allocator type.
+             */
+            using other = aligned_allocator<U, Alignment>;
+        };
+
+        /*!
+         * \brief  Default constructs an `aligned_allocator`.
+         */
+        aligned_allocator() noexcept = default;
+
+        /*!
+         * \brief     Constructs an `aligned_allocator` from another with a
+         *            different value type.
+         *
+         * \tparam U  The value type of `a`.
+         *
+         * \param a   The allocator to copy.
+         */
+        template<typename U>
+        aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept
+        {
+        }
+
+        /*!
+         * \brief    Allocates uninitialized storage for `n` objects of type
+         *           `T`.
+         *
+         * \param n  The number of objects to allocate storage for.
+         *
+         * \return   A pointer to the allocated storage.
+         *
+         * \throw    std::bad_alloc if the allocation fails.
+         */
+        T* allocate(std::size_t n)
+        {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            {
+                throw std::bad_alloc();
+            }
+
+            void* const p = tue::detail_::aligned_malloc(
+                n * sizeof(T), alignment);
+
+            if (p == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            return static_cast<T*>(p);
+        }
+
+        /*!
+         * \brief    Deallocates storage previously returned by `allocate()`.
+         *
+         * \param p  A pointer returned by `allocate()`.
+         */
+        void deallocate(T* p, std::size_t) noexcept
+        {
+            tue::detail_::aligned_free(p);
+        }
+    };
+
+    /*!
+     * \brief             Determines whether or not two `aligned_allocator`'s
+     *                    compare equal.
+     * \details           Memory allocated by one `aligned_allocator` can
+     *                    always be deallocated by another, so this always
+     *                    returns `true`.
+     *
+     * \tparam T          The value type of `lhs`.
+     * \tparam U          The value type of `rhs`.
+     * \tparam Alignment  The minimum alignment of both allocators.
+     *
+     * \return            `true`
+     */
+    template<typename T, typename U, std::size_t Alignment>
+    inline constexpr bool operator==(
+        const aligned_allocator<T, Alignment>&,
+        const aligned_allocator<U, Alignment>&) noexcept
+    {
+        return true;
+    }
+
+    /*!
+     * \brief             Determines whether or not two `aligned_allocator`'s
+     *                    compare not equal.
+     *
+     * \tparam T          The value type of `lhs`.
+     * \tparam U          The value type of `rhs`.
+     * \tparam Alignment  The minimum alignment of both allocators.
+     *
+     * \return            `false`
+     */
+    template<typename T, typename U, std::size_t Alignment>
+    inline constexpr bool operator!=(
+        const aligned_allocator<T, Alignment>&,
+        const aligned_allocator<U, Alignment>&) noexcept
+    {
+        return false;
+    }
+
+    /*!
+     * \brief    A fixed-capacity bump allocator for short-lived batches of
+     *           `simd`, `vec`, `quat`, and `mat` objects.
+     * \details  All memory is allocated up front when the arena is
+     *           constructed. Each allocation simply bumps an offset, and
+     *           `reset()` releases every allocation at once (e.g., at the end
+     *           of a frame). Destructors are never run, so only trivially
+     *           destructible types may be allocated from a `simd_arena`.
+     */
+    class simd_arena
+    {
+        unsigned char* buffer_;
+        std::size_t capacity_;
+        std::size_t size_;
+
+    public:
+        /*!
+         * \brief  The alignment (in bytes) of the arena's underlying buffer.
+         *         This is the largest alignment any `simd` type requires.
+         */
+        static constexpr std::size_t buffer_alignment = 128;
+
+        /*!
+         * \brief           Constructs a `simd_arena` with the given capacity.
+         *
+         * \param capacity  The capacity (in bytes).
+         *
+         * \throw           std::bad_alloc if the underlying buffer can't be
+         *                  allocated.
+         */
+        explicit simd_arena(std::size_t capacity)
+        :
+            buffer_(static_cast<unsigned char*>(
+                tue::detail_::aligned_malloc(capacity, buffer_alignment))),
+            capacity_(capacity),
+            size_(0)
+        {
+            if (buffer_ == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+        }
+
+        simd_arena(const simd_arena&) = delete;
+
+        /*!
+         * \brief    Move constructs a `simd_arena`, leaving `a` empty with a
+         *           capacity of `0`.
+         *
+         * \param a  The arena to move.
+         */
+        simd_arena(simd_arena&& a) noexcept
+        :
+            buffer_(a.buffer_),
+            capacity_(a.capacity_),
+            size_(a.size_)
+        {
+            a.buffer_ = nullptr;
+            a.capacity_ = 0;
+            a.size_ = 0;
+        }
+
+        /*!
+         * \brief  Releases the underlying buffer.
+         */
+        ~simd_arena()
+        {
+            tue::detail_::aligned_free(buffer_);
+        }
+
+        simd_arena& operator=(const simd_arena&) = delete;
+
+        /*!
+         * \brief    Move assigns a `simd_arena`, leaving `a` empty with a
+         *           capacity of `0`.
+         *
+         * \param a  The arena to move.
+         *
+         * \return   A reference to this `simd_arena`.
+         */
+        simd_arena& operator=(simd_arena&& a) noexcept
+        {
+            if (this != &a)
+            {
+                tue::detail_::aligned_free(buffer_);
+                buffer_ = a.buffer_;
+                capacity_ = a.capacity_;
+                size_ = a.size_;
+                a.buffer_ = nullptr;
+                a.capacity_ = 0;
+                a.size_ = 0;
+            }
+
+            return *this;
+        }
+
+        /*!
+         * \brief            Allocates uninitialized storage from this arena.
+         *
+         * \param size       The size (in bytes) of the allocation.
+         * \param alignment  The alignment (in bytes) of the allocation. Must
+         *                   be a power of two.
+         *
+         * \return           A pointer to the allocated storage or `nullptr`
+         *                   if there's not enough space left in this arena.
+         */
+        void* allocate(std::size_t size, std::size_t alignment) noexcept
+        {
+            if (buffer_ == nullptr)
+            {
+                return nullptr;
+            }
+
+            const auto base = reinterpret_cast<std::uintptr_t>(buffer_);
+            const auto offset = static_cast<std::size_t>(
+                tue::detail_::align_up(base + size_, alignment) - base);
+
+            if (offset > capacity_ || size > capacity_ - offset)
+            {
+                return nullptr;
+            }
+
+            size_ = offset + size;
+            return buffer_ + offset;
+        }
+
+        /*!
+         * \brief        Allocates uninitialized storage for `count` objects of
+         *               type `T` from this arena.
+         *
+         * \tparam T     The allocated type. Must be trivially destructible.
+         *
+         * \param count  The number of objects to allocate storage for.
+         *
+         * \return       A pointer to the allocated storage or `nullptr` if
+         *               there's not enough space left in this arena.
+         */
+        template<typename T>
+        T* allocate(std::size_t count = 1) noexcept
+        {
+            static_assert(std::is_trivially_destructible<T>::value,
+                "simd_arena never runs destructors");
+
+            if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            {
+                return nullptr;
+            }
+
+            return static_cast<T*>(
+                this->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        /*!
+         * \brief  Releases every allocation made from this arena at once.
+         *         The underlying buffer is kept for reuse.
+         */
+        void reset() noexcept
+        {
+            size_ = 0;
+        }
+
+        /*!
+         * \brief   Returns the capacity (in bytes) of this arena.
+         *
+         * \return  The capacity (in bytes) of this arena.
+         */
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        /*!
+         * \brief   Returns the number of bytes currently in use (including
+         *          alignment padding).
+         *
+         * \return  The number of bytes currently in use.
+         */
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+    };
+
+    /*!@}*/
+}
@@ -0,0 +1,756 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "simd.hpp"
+
+#ifdef TUE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace tue
+{
+    namespace detail_
+    {
+        template<typename T>
+        inline constexpr float normalized_max() noexcept
+        {
+            return float(std::numeric_limits<T>::max());
+        }
+
+        template<typename T>
+        inline constexpr float unorm_to_float(T bits) noexcept
+        {
+            return float(bits) * (1.0f / tue::detail_::normalized_max<T>());
+        }
+
+        template<typename T>
+        inline constexpr float snorm_to_float(T bits) noexcept
+        {
+            // The most negative value would map slightly below -1
+            return float(bits) * (1.0f / tue::detail_::normalized_max<T>())
+                    > -1.0f
+                ? float(bits) * (1.0f / tue::detail_::normalized_max<T>())
+                : -1.0f;
+        }
+
+        template<typename T>
+        inline constexpr T float_to_unorm(float x) noexcept
+        {
+            // NaN compares false, so it falls through to 0
+            return x > 0.0f
+                ? x < 1.0f
+                    ? T(x * tue::detail_::normalized_max<T>() + 0.5f)
+                    : std::numeric_limits<T>::max()
+                : T(0);
+        }
+
+        template<typename T>
+        inline constexpr T float_to_snorm(float x) noexcept
+        {
+            return x > -1.0f
+                ? x < 1.0f
+                    ? T(x * tue::detail_::normalized_max<T>()
+                        + (x < 0.0f ? -0.5f : 0.5f))
+                    : std::numeric_limits<T>::max()
+                : x == x
+                    ? T(-std::numeric_limits<T>::max())
+                    : T(0);
+        }
+
+        template<typename T>
+        inline constexpr float normalized_to_float(T bits) noexcept
+        {
+            return std::is_signed<T>::value
+                ? tue::detail_::snorm_to_float(bits)
+                : tue::detail_::unorm_to_float(bits);
+        }
+
+        template<typename T>
+        inline constexpr T float_to_normalized(float x) noexcept
+        {
+            return std::is_signed<T>::value
+                ? tue::detail_::float_to_snorm<T>(x)
+                : tue::detail_::float_to_unorm<T>(x);
+        }
+    }
+
+    /*!
+     * \defgroup  normalized_hpp <tue/normalized.hpp>
+     *
+     * \brief     The `unorm` and `snorm` class templates and their associated
+     *            conversion functions.
+     * @{
+     */
+
+    /*!
+     * \brief     An unsigned normalized integer which maps `[0, max]` to
+     *            `[0.0f, 1.0f]`.
+     * \details   `unorm` is a storage type only (e.g., for vertex colors and
+     *            texture coordinates). It doesn't define any arithmetic
+     *            operators. Convert to `float` (or to `float32x4`,
+     *            `float32x8`, etc. with `unpack_unorm()`) to do math with it.
+     *            Conversions from `float` clamp to `[0.0f, 1.0f]`, round to
+     *            nearest (ties away from zero), and map NaN to `0`.
+     *
+     * \tparam T  The underlying integral type. Must be `std::uint8_t` or
+     *            `std::uint16_t`.
+     */
+    template<typename T>
+    class unorm
+    {
+        static_assert(std::is_same<T, std::uint8_t>::value
+                || std::is_same<T, std::uint16_t>::value,
+            "T must be std::uint8_t or std::uint16_t");
+
+        T bits_;
+
+        struct from_bits_tag {};
+
+        constexpr unorm(T bits, from_bits_tag) noexcept
+        :
+            bits_(bits)
+        {
+        }
+
+    public:
+        /*!
+         * \brief  Default constructs a `unorm` with an indeterminate value.
+         */
+        unorm() noexcept = default;
+
+        /*!
+         * \brief    Constructs a `unorm` with the value of `x` clamped to
+         *           `[0.0f, 1.0f]` and rounded to the nearest representable
+         *           value.
+         *
+         * \param x  The value to convert.
+         */
+        explicit constexpr unorm(float x) noexcept
+        :
+            bits_(tue::detail_::float_to_unorm<T>(x))
+        {
+        }
+
+        /*!
+         * \brief       Constructs a `unorm` from its binary representation.
+         *
+         * \param bits  The binary representation.
+         *
+         * \return      The new `unorm`.
+         */
+        static constexpr unorm from_bits(T bits) noexcept
+        {
+            return unorm(bits, from_bits_tag());
+        }
+
+        /*!
+         * \brief   Returns the binary representation of this `unorm`.
+         *
+         * \return  The binary representation of this `unorm`.
+         */
+        constexpr T bits() const noexcept
+        {
+            return bits_;
+        }
+
+        /*!
+         * \brief   Converts this `unorm` to a `float` in `[0.0f, 1.0f]`.
+         *
+         * \return  This `unorm` as a `float`.
+         */
+        explicit constexpr operator float() const noexcept
+        {
+            return tue::detail_::unorm_to_float(bits_);
+        }
+    };
+
+    /*!
+     * \brief     A signed normalized integer which maps `[-max, max]` to
+     *            `[-1.0f, 1.0f]`.
+     * \details   `snorm` is a storage type only (e.g., for normals and
+     *            tangents). It doesn't define any arithmetic operators.
+     *            Convert to `float` (or to `float32x4`, `float32x8`, etc. with
+     *            `unpack_snorm()`) to do math with it. The most negative
+     *            integer also maps to `-1.0f`. Conversions from `float` clamp
+     *            to `[-1.0f, 1.0f]`, round to nearest (ties away from zero),
+     *            and map NaN to `0`.
+     *
+     * \tparam T  The underlying integral type. Must be `std::int8_t` or
+     *            `std::int16_t`.
+     */
+    template<typename T>
+    class snorm
+    {
+        static_assert(std::is_same<T, std::int8_t>::value
+                || std::is_same<T, std::int16_t>::value,
+            "T must be std::int8_t or std::int16_t");
+
+        T bits_;
+
+        struct from_bits_tag {};
+
+        constexpr snorm(T bits, from_bits_tag) noexcept
+        :
+            bits_(bits)
+        {
+        }
+
+    public:
+        /*!
+         * \brief  Default constructs a `snorm` with an indeterminate value.
+         */
+        snorm() noexcept = default;
+
+        /*!
+         * \brief    Constructs a `snorm` with the value of `x` clamped to
+         *           `[-1.0f, 1.0f]` and rounded to the nearest representable
+         *           value.
+         *
+         * \param x  The value to convert.
+         */
+        explicit constexpr snorm(float x) noexcept
+        :
+            bits_(tue::detail_::float_to_snorm<T>(x))
+        {
+        }
+
+        /*!
+         * \brief       Constructs a `snorm` from its binary representation.
+         *
+         * \param bits  The binary representation.
+         *
+         * \return      The new `snorm`.
+         */
+        static constexpr snorm from_bits(T bits) noexcept
+        {
+            return snorm(bits, from_bits_tag());
+        }
+
+        /*!
+         * \brief   Returns the binary representation of this `snorm`.
+         *
+         * \return  The binary representation of this `snorm`.
+         */
+        constexpr T bits() const noexcept
+        {
+            return bits_;
+        }
+
+        /*!
+         * \brief   Converts this `snorm` to a `float` in `[-1.0f, 1.0f]`.
+         *
+         * \return  This `snorm` as a `float`.
+         */
+        explicit constexpr operator float() const noexcept
+        {
+            return tue::detail_::snorm_to_float(bits_);
+        }
+    };
+
+    /*!
+     * \brief  An 8-bit unsigned normalized integer.
+     */
+    using unorm8 = unorm<std::uint8_t>;
+
+    /*!
+     * \brief  A 16-bit unsigned normalized integer.
+     */
+    using unorm16 = unorm<std::uint16_t>;
+
+    /*!
+     * \brief  An 8-bit signed normalized integer.
+     */
+    using snorm8 = snorm<std::int8_t>;
+
+    /*!
+     * \brief  A 16-bit signed normalized integer.
+     */
+    using snorm16 = snorm<std::int16_t>;
+
+    /*!@}*/
+
+    static_assert(sizeof(unorm8) == 1, "unorm8 is not 8-bits wide");
+    static_assert(sizeof(unorm16) == 2, "unorm16 is not 16-bits wide");
+    static_assert(sizeof(snorm8) == 1, "snorm8 is not 8-bits wide");
+    static_assert(sizeof(snorm16) == 2, "snorm16 is not 16-bits wide");
+
+    namespace detail_
+    {
+#ifdef TUE_SSE2
+        inline __m128 unorm_i32x4_to_float32x4(
+            __m128i i, float max) noexcept
+        {
+            return _mm_mul_ps(_mm_cvtepi32_ps(i), _mm_set1_ps(1.0f / max));
+        }
+
+        inline __m128 snorm_i32x4_to_float32x4(
+            __m128i i, float max) noexcept
+        {
+            return _mm_max_ps(
+                _mm_mul_ps(_mm_cvtepi32_ps(i), _mm_set1_ps(1.0f / max)),
+                _mm_set1_ps(-1.0f));
+        }
+
+        inline __m128i float32x4_to_unorm_i32x4(
+            __m128 f, float max) noexcept
+        {
+            // _mm_max_ps() returns its second operand for NaN
+            const auto clamped = _mm_min_ps(
+                _mm_max_ps(f, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+            return _mm_cvttps_epi32(_mm_add_ps(
+                _mm_mul_ps(clamped, _mm_set1_ps(max)), _mm_set1_ps(0.5f)));
+        }
+
+        inline __m128i float32x4_to_snorm_i32x4(
+            __m128 f, float max) noexcept
+        {
+            const auto clamped = _mm_min_ps(
+                _mm_max_ps(_mm_and_ps(f, _mm_cmpord_ps(f, f)),
+                    _mm_set1_ps(-1.0f)),
+                _mm_set1_ps(1.0f));
+            const auto half = _mm_or_ps(_mm_set1_ps(0.5f),
+                _mm_and_ps(clamped, _mm_set1_ps(-0.0f)));
+            return _mm_cvttps_epi32(_mm_add_ps(
+                _mm_mul_ps(clamped, _mm_set1_ps(max)), half));
+        }
+
+        template<typename T>
+        struct normalized_sse2;
+
+        template<>
+        struct normalized_sse2<std::uint8_t>
+        {
+            static void unpack(__m128i s, __m128* f) noexcept
+            {
+                const auto zero = _mm_setzero_si128();
+                const auto lo = _mm_unpacklo_epi8(s, zero);
+                const auto hi = _mm_unpackhi_epi8(s, zero);
+                f[0] = tue::detail_::unorm_i32x4_to_float32x4(
+                    _mm_unpacklo_epi16(lo, zero), 255.0f);
+                f[1] = tue::detail_::unorm_i32x4_to_float32x4(
+                    _mm_unpackhi_epi16(lo, zero), 255.0f);
+                f[2] = tue::detail_::unorm_i32x4_to_float32x4(
+                    _mm_unpacklo_epi16(hi, zero), 255.0f);
+                f[3] = tue::detail_::unorm_i32x4_to_float32x4(
+                    _mm_unpackhi_epi16(hi, zero), 255.0f);
+            }
+
+            static __m128i pack(const __m128* f) noexcept
+            {
+                // Every value is already in [0, 255], so the saturating
+                // packs are exact.
+                return _mm_packus_epi16(
+                    _mm_packs_epi32(
+                        tue::detail_::float32x4_to_unorm_i32x4(f[0], 255.0f),
+                        tue::detail_::float32x4_to_unorm_i32x4(f[1], 255.0f)),
+                    _mm_packs_epi32(
+                        tue::detail_::float32x4_to_unorm_i32x4(f[2], 255.0f),
+                        tue::detail_::float32x4_to_unorm_i32x4(f[3], 255.0f)));
+            }
+        };
+
+        template<>
+        struct normalized_sse2<std::int8_t>
+        {
+            static void unpack(__m128i s, __m128* f) noexcept
+            {
+                // Interleaving a value with itself and shifting it back down
+                // arithmetically sign extends it.
+                const auto lo = _mm_srai_epi16(_mm_unpacklo_epi8(s, s), 8);
+                const auto hi = _mm_srai_epi16(_mm_unpackhi_epi8(s, s), 8);
+                f[0] = tue::detail_::snorm_i32x4_to_float32x4(
+                    _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 16), 127.0f);
+                f[1] = tue::detail_::snorm_i32x4_to_float32x4(
+                    _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 16), 127.0f);
+                f[2] = tue::detail_::snorm_i32x4_to_float32x4(
+                    _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 16), 127.0f);
+                f[3] = tue::detail_::snorm_i32x4_to_float32x4(
+                    _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 16), 127.0f);
+            }
+
+            static __m128i pack(const __m128* f) noexcept
+            {
+                return _mm_packs_epi16(
+                    _mm_packs_epi32(
+                        tue::detail_::float32x4_to_snorm_i32x4(f[0], 127.0f),
+                        tue::detail_::float32x4_to_snorm_i32x4(f[1], 127.0f)),
+                    _mm_packs_epi32(
+                        tue::detail_::float32x4_to_snorm_i32x4(f[2], 127.0f),
+                        tue::detail_::float32x4_to_snorm_i32x4(f[3], 127.0f)));
+            }
+        };
+
+        template<>
+        struct normalized_sse2<std::uint16_t>
+        {
+            static void unpack(__m128i s, __m128* f) noexcept
+            {
+                const auto zero = _mm_setzero_si128();
+                f[0] = tue::detail_::unorm_i32x4_to_float32x4(
+                    _mm_unpacklo_epi16(s, zero), 65535.0f);
+                f[1] = tue::detail_::unorm_i32x4_to_float32x4(
+                    _mm_unpackhi_epi16(s, zero), 65535.0f);
+            }
+
+            static __m128i pack(const __m128* f) noexcept
+            {
+                // SSE2 has no unsigned 32-to-16-bit pack, so bias the values
+                // into int16_t range, pack, and flip the sign bits back.
+                const auto bias = _mm_set1_epi32(0x8000);
+                return _mm_xor_si128(
+                    _mm_packs_epi32(
+                        _mm_sub_epi32(tue::detail_::float32x4_to_unorm_i32x4(
+                            f[0], 65535.0f), bias),
+                        _mm_sub_epi32(tue::detail_::float32x4_to_unorm_i32x4(
+                            f[1], 65535.0f), bias)),
+                    _mm_set1_epi16(std::int16_t(0x8000)));
+            }
+        };
+
+        template<>
+        struct normalized_sse2<std::int16_t>
+        {
+            static void unpack(__m128i s, __m128* f) noexcept
+            {
+                f[0] = tue::detail_::snorm_i32x4_to_float32x4(
+                    _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16), 32767.0f);
+                f[1] = tue::detail_::snorm_i32x4_to_float32x4(
+                    _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16), 32767.0f);
+            }
+
+            static __m128i pack(const __m128* f) noexcept
+            {
+                return _mm_packs_epi32(
+                    tue::detail_::float32x4_to_snorm_i32x4(f[0], 32767.0f),
+                    tue::detail_::float32x4_to_snorm_i32x4(f[1], 32767.0f));
+            }
+        };
+#endif
+
+        template<typename T, int N>
+        struct normalized_utils
+        {
+            // The number of T's in a 128-bit register
+            static constexpr int native_count = 16 / int(sizeof(T));
+
+            using split_tag = std::integral_constant<int, 1>;
+            using native_tag = std::integral_constant<int, 0>;
+            using scalar_tag = std::integral_constant<int, -1>;
+
+            using tag = std::integral_constant<int,
+                (N > native_count) - (N < native_count)>;
+
+            static simd<float, N> unpack(const simd<T, N>& s) noexcept
+            {
+                return unpack(s, tag());
+            }
+
+            static simd<T, N> pack(const simd<float, N>& s) noexcept
+            {
+                return pack(s, tag());
+            }
+
+            static simd<float, N> unpack(
+                const simd<T, N>& s, split_tag) noexcept
+            {
+                simd<float, N> result;
+                const auto rimpl =
+                    reinterpret_cast<simd<float, N/2>*>(&result);
+                const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+                rimpl[0] = normalized_utils<T, N/2>::unpack(simpl[0]);
+                rimpl[1] = normalized_utils<T, N/2>::unpack(simpl[1]);
+                return result;
+            }
+
+            static simd<T, N> pack(
+                const simd<float, N>& s, split_tag) noexcept
+            {
+                simd<T, N> result;
+                const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+                const auto simpl =
+                    reinterpret_cast<const simd<float, N/2>*>(&s);
+                rimpl[0] = normalized_utils<T, N/2>::pack(simpl[0]);
+                rimpl[1] = normalized_utils<T, N/2>::pack(simpl[1]);
+                return result;
+            }
+
+            static simd<float, N> unpack(
+                const simd<T, N>& s, native_tag) noexcept
+            {
+#ifdef TUE_SSE2
+                simd<float, N> result;
+                tue::detail_::normalized_sse2<T>::unpack(
+                    s, reinterpret_cast<__m128*>(&result));
+                return result;
+#else
+                return unpack(s, scalar_tag());
+#endif
+            }
+
+            static simd<T, N> pack(
+                const simd<float, N>& s, native_tag) noexcept
+            {
+#ifdef TUE_SSE2
+                return tue::detail_::normalized_sse2<T>::pack(
+                    reinterpret_cast<const __m128*>(&s));
+#else
+                return pack(s, scalar_tag());
+#endif
+            }
+
+            static simd<float, N> unpack(
+                const simd<T, N>& s, scalar_tag) noexcept
+            {
+                simd<float, N> result;
+                const auto rdata = result.data();
+                const auto sdata = s.data();
+                for (int i = 0; i < N; ++i)
+                {
+                    rdata[i] = tue::detail_::normalized_to_float(sdata[i]);
+                }
+                return result;
+            }
+
+            static simd<T, N> pack(
+                const simd<float, N>& s, scalar_tag) noexcept
+            {
+                simd<T, N> result;
+                const auto rdata = result.data();
+                const auto sdata = s.data();
+                for (int i = 0; i < N; ++i)
+                {
+                    rdata[i] =
+                        tue::detail_::float_to_normalized<T>(sdata[i]);
+                }
+                return result;
+            }
+        };
+
+        template<typename T>
+        inline void unpack_normalized_n(
+            const T* src, std::size_t count, float* dst) noexcept
+        {
+            constexpr int n = normalized_utils<T, 16>::native_count;
+            const auto blocked_count = count & ~std::size_t(n - 1);
+
+            std::size_t i = 0;
+            for (; i < blocked_count; i += n)
+            {
+                normalized_utils<T, n>::unpack(
+                    simd<T, n>::loadu(src + i)).storeu(dst + i);
+            }
+
+            for (; i < count; ++i)
+            {
+                dst[i] = tue::detail_::normalized_to_float(src[i]);
+            }
+        }
+
+        template<typename T>
+        inline void pack_normalized_n(
+            const float* src, std::size_t count, T* dst) noexcept
+        {
+            constexpr int n = normalized_utils<T, 16>::native_count;
+            const auto blocked_count = count & ~std::size_t(n - 1);
+
+            std::size_t i = 0;
+            for (; i < blocked_count; i += n)
+            {
+                normalized_utils<T, n>::pack(
+                    simd<float, n>::loadu(src + i)).storeu(dst + i);
+            }
+
+            for (; i < count; ++i)
+            {
+                dst[i] = tue::detail_::float_to_normalized<T>(src[i]);
+            }
+        }
+    }
+
+    /*!
+     * \addtogroup  normalized_hpp
+     * @{
+     */
+
+    /*!
+     * \brief     Converts each component of `s` from the binary
+     *            representation of a `unorm<T>` to a `float` in
+     *            `[0.0f, 1.0f]`.
+     * \details   E.g., `unpack_unorm(uint8x16)` returns a `float32x16`. The
+     *            native register width (`uint8x16` or `uint16x8`) is
+     *            converted with SSE2 when `TUE_SSE2` is defined.
+     *
+     * \tparam T  The component type of `s`. Must be `std::uint8_t` or
+     *            `std::uint16_t`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   The `simd` to convert.
+     *
+     * \return    The converted `simd`.
+     */
+    template<typename T, int N>
+    inline simd<float, N> unpack_unorm(const simd<T, N>& s) noexcept
+    {
+        static_assert(std::is_same<T, std::uint8_t>::value
+                || std::is_same<T, std::uint16_t>::value,
+            "T must be std::uint8_t or std::uint16_t");
+        return tue::detail_::normalized_utils<T, N>::unpack(s);
+    }
+
+    /*!
+     * \brief     Converts each component of `s` from the binary
+     *            representation of a `snorm<T>` to a `float` in
+     *            `[-1.0f, 1.0f]`.
+     * \details   E.g., `unpack_snorm(int16x8)` returns a `float32x8`. The
+     *            native register width (`int8x16` or `int16x8`) is converted
+     *            with SSE2 when `TUE_SSE2` is defined.
+     *
+     * \tparam T  The component type of `s`. Must be `std::int8_t` or
+     *            `std::int16_t`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   The `simd` to convert.
+     *
+     * \return    The converted `simd`.
+     */
+    template<typename T, int N>
+    inline simd<float, N> unpack_snorm(const simd<T, N>& s) noexcept
+    {
+        static_assert(std::is_same<T, std::int8_t>::value
+                || std::is_same<T, std::int16_t>::value,
+            "T must be std::int8_t or std::int16_t");
+        return tue::detail_::normalized_utils<T, N>::unpack(s);
+    }
+
+    /*!
+     * \brief     Converts each component of `s` to the binary representation
+     *            of a `unorm<T>`, with the same clamping and rounding as
+     *            `unorm<T>::unorm(float)`.
+     * \details   E.g., `pack_unorm<std::uint8_t>(float32x16)` returns a
+     *            `uint8x16`.
+     *
+     * \tparam T  The component type of the returned `simd`. Must be
+     *            `std::uint8_t` or `std::uint16_t`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   The `simd` to convert.
+     *
+     * \return    The converted `simd`.
+     */
+    template<typename T, int N>
+    inline simd<T, N> pack_unorm(const simd<float, N>& s) noexcept
+    {
+        static_assert(std::is_same<T, std::uint8_t>::value
+                || std::is_same<T, std::uint16_t>::value,
+            "T must be std::uint8_t or std::uint16_t");
+        return tue::detail_::normalized_utils<T, N>::pack(s);
+    }
+
+    /*!
+     * \brief     Converts each component of `s` to the binary representation
+     *            of a `snorm<T>`, with the same clamping and rounding as
+     *            `snorm<T>::snorm(float)`.
+     * \details   E.g., `pack_snorm<std::int16_t>(float32x8)` returns an
+     *            `int16x8`.
+     *
+     * \tparam T  The component type of the returned `simd`. Must be
+     *            `std::int8_t` or `std::int16_t`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   The `simd` to convert.
+     *
+     * \return    The converted `simd`.
+     */
+    template<typename T, int N>
+    inline simd<T, N> pack_snorm(const simd<float, N>& s) noexcept
+    {
+        static_assert(std::is_same<T, std::int8_t>::value
+                || std::is_same<T, std::int16_t>::value,
+            "T must be std::int8_t or std::int16_t");
+        return tue::detail_::normalized_utils<T, N>::pack(s);
+    }
+
+    /*!
+     * \brief        Converts `count` `unorm` values to `float`.
+     *
+     * \tparam T     The underlying integral type of the `unorm`'s.
+     *
+     * \param src    A pointer to the values to convert.
+     * \param count  The number of values to convert.
+     * \param dst    A pointer to where the converted values will be stored.
+     */
+    template<typename T>
+    inline void convert_n(
+        const unorm<T>* src, std::size_t count, float* dst) noexcept
+    {
+        tue::detail_::unpack_normalized_n(
+            reinterpret_cast<const T*>(src), count, dst);
+    }
+
+    /*!
+     * \brief        Converts `count` `snorm` values to `float`.
+     *
+     * \tparam T     The underlying integral type of the `snorm`'s.
+     *
+     * \param src    A pointer to the values to convert.
+     * \param count  The number of values to convert.
+     * \param dst    A pointer to where the converted values will be stored.
+     */
+    template<typename T>
+    inline void convert_n(
+        const snorm<T>* src, std::size_t count, float* dst) noexcept
+    {
+        tue::detail_::unpack_normalized_n(
+            reinterpret_cast<const T*>(src), count, dst);
+    }
+
+    /*!
+     * \brief        Converts `count` `float` values to `unorm` (clamping and
+     *               rounding to nearest).
+     *
+     * \tparam T     The underlying integral type of the `unorm`'s.
+     *
+     * \param src    A pointer to the values to convert.
+     * \param count  The number of values to convert.
+     * \param dst    A pointer to where the converted values will be stored.
+     */
+    template<typename T>
+    inline void convert_n(
+        const float* src, std::size_t count, unorm<T>* dst) noexcept
+    {
+        tue::detail_::pack_normalized_n(
+            src, count, reinterpret_cast<T*>(dst));
+    }
+
+    /*!
+     * \brief        Converts `count` `float` values to `snorm` (clamping and
+     *               rounding to nearest).
+     *
+     * \tparam T     The underlying integral type of the `snorm`'s.
+     *
+     * \param src    A pointer to the values to convert.
+     * \param count  The number of values to convert.
+     * \param dst    A pointer to where the converted values will be stored.
+     */
+    template<typename T>
+    inline void convert_n(
+        const float* src, std::size_t count, snorm<T>* dst) noexcept
+    {
+        tue::detail_::pack_normalized_n(
+            src, count, reinterpret_cast<T*>(dst));
+    }
+
+    /*!@}*/
+}
@@ -0,0 +1,204 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+
+#include "float16.hpp"
+#include "math.hpp"
+#include "normalized.hpp"
+#include "simd.hpp"
+#include "vec.hpp"
+
+/*!
+ * \defgroup  octahedral_hpp <tue/octahedral.hpp>
+ *
+ * \brief     Functions for encoding unit vectors (e.g., normals) with an
+ *            octahedral mapping.
+ * \details   An octahedral encoding projects a unit vector onto the
+ *            octahedron `|x| + |y| + |z| = 1` and then unfolds the lower
+ *            half over the upper half, giving a 2-component encoding in
+ *            `[-1, 1]` with a nearly uniform error distribution. Stored as
+ *            two `snorm16`'s, a normal takes 4 bytes instead of 12 with a
+ *            worst-case angular error of roughly 0.005 degrees.
+ */
+namespace tue
+{
+    /*!
+     * \addtogroup  octahedral_hpp
+     * @{
+     */
+
+    /*!
+     * \brief     Encodes a unit vector with an octahedral mapping.
+     * \details   `n` doesn't need to be normalized, but its length must not
+     *            be `0`.
+     *
+     * \tparam T  The component type of `n`. Can be a `simd` type to encode
+     *            several vectors at once.
+     *
+     * \param n   The vector to encode.
+     *
+     * \return    The encoded vector with components in `[-1, 1]`.
+     */
+    template<typename T>
+    inline vec2<T> octahedral_encode(const vec3<T>& n) noexcept
+    {
+        const auto ax = tue::math::abs(n[0]);
+        const auto ay = tue::math::abs(n[1]);
+        const auto az = tue::math::abs(n[2]);
+        const auto rl1 = T(1) / (ax + ay + az);
+
+        const auto px = n[0] * rl1;
+        const auto py = n[1] * rl1;
+
+        // Fold the lower hemisphere over the diagonals, keeping the sign of
+        // the original x and y (with 0 counting as positive).
+        const auto sx = tue::math::select(
+            tue::math::greater_equal(n[0], T(0)), T(1), T(-1));
+        const auto sy = tue::math::select(
+            tue::math::greater_equal(n[1], T(0)), T(1), T(-1));
+        const auto fx = (T(1) - ay * rl1) * sx;
+        const auto fy = (T(1) - ax * rl1) * sy;
+
+        const auto lower = tue::math::less(n[2], T(0));
+        return {
+            tue::math::select(lower, fx, px),
+            tue::math::select(lower, fy, py),
+        };
+    }
+
+    /*!
+     * \brief     Decodes a unit vector encoded with `octahedral_encode()`.
+     * \details   The result is normalized with `tue::math::normalize()`, so
+     *            its accuracy for `float32x4`'s and `float32x8`'s is limited
+     *            by `tue::math::rsqrt()`.
+     *
+     * \tparam T  The component type of `e`. Can be a `simd` type to decode
+     *            several vectors at once.
+     *
+     * \param e   The encoded vector.
+     *
+     * \return    The decoded unit vector.
+     */
+    template<typename T>
+    inline vec3<T> octahedral_decode(const vec2<T>& e) noexcept
+    {
+        const auto z = T(1) - tue::math::abs(e[0]) - tue::math::abs(e[1]);
+
+        // For the lower hemisphere, t = -z undoes the fold; for the upper
+        // hemisphere it's 0 and x and y pass through unchanged.
+        const auto t = tue::math::max(-z, T(0));
+        const auto x = e[0] + tue::math::select(
+            tue::math::greater_equal(e[0], T(0)), -t, t);
+        const auto y = e[1] + tue::math::select(
+            tue::math::greater_equal(e[1], T(0)), -t, t);
+
+        return tue::math::normalize(vec3<T>(x, y, z));
+    }
+
+    /*!
+     * \brief        Encodes `count` unit vectors with `octahedral_encode()`
+     *               and stores them as pairs of `S`'s.
+     * \details      The vectors are encoded eight at a time as
+     *               `vec3<float32x8>`'s and converted to `S` with
+     *               `convert_n()`.
+     *
+     * \tparam S     The storage type. Must be `snorm8`, `snorm16`, or
+     *               `float16`.
+     *
+     * \param src    A pointer to the vectors to encode.
+     * \param count  The number of vectors to encode.
+     * \param dst    A pointer to where `2 * count` values will be stored
+     *               (the encoded x and y of each vector in turn).
+     */
+    template<typename S>
+    inline void octahedral_encode_n(
+        const fvec3* src, std::size_t count, S* dst) noexcept
+    {
+        alignas(float32x8) float buffer[16];
+
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            vec3<float32x8> n;
+            for (int j = 0; j < 8; ++j)
+            {
+                n[0].data()[j] = src[i+j][0];
+                n[1].data()[j] = src[i+j][1];
+                n[2].data()[j] = src[i+j][2];
+            }
+
+            const auto e = tue::octahedral_encode(n);
+            for (int j = 0; j < 8; ++j)
+            {
+                buffer[2*j] = e[0].data()[j];
+                buffer[2*j+1] = e[1].data()[j];
+            }
+
+            tue::convert_n(buffer, 16, dst + 2*i);
+        }
+
+        for (; i < count; ++i)
+        {
+            const auto e = tue::octahedral_encode(src[i]);
+            buffer[0] = e[0];
+            buffer[1] = e[1];
+            tue::convert_n(buffer, 2, dst + 2*i);
+        }
+    }
+
+    /*!
+     * \brief        Decodes `count` unit vectors stored by
+     *               `octahedral_encode_n()`.
+     * \details      The vectors are converted from `S` with `convert_n()`
+     *               and decoded eight at a time as `vec2<float32x8>`'s.
+     *
+     * \tparam S     The storage type. Must be `snorm8`, `snorm16`, or
+     *               `float16`.
+     *
+     * \param src    A pointer to `2 * count` values to decode.
+     * \param count  The number of vectors to decode.
+     * \param dst    A pointer to where the decoded vectors will be stored.
+     */
+    template<typename S>
+    inline void octahedral_decode_n(
+        const S* src, std::size_t count, fvec3* dst) noexcept
+    {
+        alignas(float32x8) float buffer[16];
+
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            tue::convert_n(src + 2*i, 16, buffer);
+
+            vec2<float32x8> e;
+            for (int j = 0; j < 8; ++j)
+            {
+                e[0].data()[j] = buffer[2*j];
+                e[1].data()[j] = buffer[2*j+1];
+            }
+
+            const auto n = tue::octahedral_decode(e);
+            for (int j = 0; j < 8; ++j)
+            {
+                dst[i+j] = fvec3(
+                    n[0].data()[j], n[1].data()[j], n[2].data()[j]);
+            }
+        }
+
+        for (; i < count; ++i)
+        {
+            tue::convert_n(src + 2*i, 2, buffer);
+            dst[i] = tue::octahedral_decode(fvec2(buffer[0], buffer[1]));
+        }
+    }
+
+    /*!@}*/
+}
@@ -12,6 +12,7 @@
 #include <utility>
 
 #include "math.hpp"
+#include "simd.hpp"
 #include "vec.hpp"
 
 namespace tue
@@ -572,6 +573,55 @@ namespace tue
     }
 
     /*!@}*/
+    namespace detail_
+    {
+        template<typename T>
+        inline T quat_dot(const quat<T>& q1, const quat<T>& q2) noexcept
+        {
+            return q1[0]*q2[0] + q1[1]*q2[1] + q1[2]*q2[2] + q1[3]*q2[3];
+        }
+
+        // t is 2(v x u) where u and w are the vector and scalar parts of a
+        // normalized quat
+        template<typename T, typename U, typename V>
+        inline constexpr vec3<V> rotate_m(
+            const vec3<T>& v, const vec3<U>& u, const U& w,
+            const vec3<V>& t) noexcept
+        {
+            return v + t*w + tue::math::cross(t, u);
+        }
+
+        // acos(x) for 0 <= x <= 1 (Abramowitz and Stegun 4.4.46). The
+        // absolute error is at most 2e-8.
+        template<typename T>
+        inline T acos_unit(const T& x) noexcept
+        {
+            const auto p = T(1.5707963050f) + x*(T(-0.2145988016f)
+                + x*(T(0.0889789874f) + x*(T(-0.0501743046f)
+                + x*(T(0.0308918810f) + x*(T(-0.0170881256f)
+                + x*(T(0.0066700901f) + x*T(-0.0012624911f)))))));
+            return tue::math::sqrt(T(1.0f) - x) * p;
+        }
+
+        // Computes the normalized weighted sum q1*w1 + q2*w2. The division
+        // is exact instead of using rsqrt() so blends don't drift when
+        // they're fed back in as inputs.
+        template<typename T>
+        inline quat<T> blend_quats(
+            const quat<T>& q1, const T& w1,
+            const quat<T>& q2, const T& w2) noexcept
+        {
+            const quat<T> q(
+                q1[0]*w1 + q2[0]*w2,
+                q1[1]*w1 + q2[1]*w2,
+                q1[2]*w1 + q2[2]*w2,
+                q1[3]*w1 + q2[3]*w2);
+            const auto rlength = T(1.0f)
+                / tue::math::sqrt(tue::detail_::quat_dot(q, q));
+            return { q[0]*rlength, q[1]*rlength, q[2]*rlength, q[3]*rlength };
+        }
+    }
+
     namespace math
     {
         /*!
@@ -616,6 +666,132 @@ namespace tue
             return { -q[0], -q[1], -q[2], q[3] };
         }
 
+        /*!
+         * \brief     Computes a copy of `v` rotated by `q`.
+         * \details   Gives the same result as `v * q` for a normalized `q`, but
+         *            uses `v + 2w(v x q.v()) + (2(v x q.v())) x q.v()` instead
+         *            of two full `quat` multiplications, which is about half
+         *            as many multiplications.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam U  The component type of `q`.
+         *
+         * \param v   A `vec3`.
+         * \param q   A rotation `quat`. Must be normalized.
+         *
+         * \return    A copy of `v` rotated by `q`.
+         */
+        template<typename T, typename U>
+        inline constexpr vec3<decltype(std::declval<T>() * std::declval<U>())>
+        rotate(const vec3<T>& v, const quat<U>& q) noexcept
+        {
+            return tue::detail_::rotate_m(v, q.v(), q.s(),
+                tue::math::cross(v, q.v()) * U(2));
+        }
+
+        /*!
+         * \brief     Normalized linear interpolation between two rotations.
+         * \details   Takes the shorter path between `q1` and `q2`. The result
+         *            is a good approximation of `slerp()` at a fraction of the
+         *            cost, but its angular velocity isn't constant.
+         *
+         *            This function is branch-free, so it works component-wise
+         *            on `quat`'s of SIMD types.
+         *
+         * \tparam T  The component type.
+         *
+         * \param q1  The unit `quat` at `t == 0`.
+         * \param q2  The unit `quat` at `t == 1`.
+         * \param t   The interpolation parameter.
+         *
+         * \return    The interpolated unit `quat`.
+         */
+        template<typename T>
+        inline quat<T> nlerp(
+            const quat<T>& q1, const quat<T>& q2, const T& t) noexcept
+        {
+            const auto sign = tue::math::select(
+                tue::math::less(tue::detail_::quat_dot(q1, q2), T(0.0f)),
+                T(-1.0f), T(1.0f));
+            return tue::detail_::blend_quats(q1, T(1.0f) - t, q2, t * sign);
+        }
+
+        /*!
+         * \brief     Spherical linear interpolation between two rotations.
+         * \details   Takes the shorter path between `q1` and `q2` at a
+         *            constant angular velocity. Rotations less than about 3.6
+         *            degrees apart fall back to `nlerp()`, which is
+         *            indistinguishable at that range.
+         *
+         *            This function is branch-free, so it works component-wise
+         *            on `quat`'s of SIMD types.
+         *
+         * \tparam T  The component type.
+         *
+         * \param q1  The unit `quat` at `t == 0`.
+         * \param q2  The unit `quat` at `t == 1`.
+         * \param t   The interpolation parameter.
+         *
+         * \return    The interpolated unit `quat`.
+         */
+        template<typename T>
+        inline quat<T> slerp(
+            const quat<T>& q1, const quat<T>& q2, const T& t) noexcept
+        {
+            const auto d = tue::detail_::quat_dot(q1, q2);
+            const auto sign = tue::math::select(
+                tue::math::less(d, T(0.0f)), T(-1.0f), T(1.0f));
+            const auto cos_theta = tue::math::min(d * sign, T(1.0f));
+            const auto linear = tue::math::greater(cos_theta, T(0.9995f));
+
+            const auto theta = tue::detail_::acos_unit(cos_theta);
+            const auto rsin_theta = T(1.0f) / tue::math::select(
+                linear, T(1.0f), tue::math::sin(theta));
+            const auto w1 = tue::math::select(linear, T(1.0f) - t,
+                tue::math::sin((T(1.0f) - t) * theta) * rsin_theta);
+            const auto w2 = tue::math::select(linear, t,
+                tue::math::sin(t * theta) * rsin_theta);
+            return tue::detail_::blend_quats(q1, w1, q2, w2 * sign);
+        }
+
+        /*!
+         * \brief     Approximately constant-velocity interpolation between
+         *            two rotations.
+         * \details   Corrects `t` with a cubic spline fitted to the angle
+         *            between `q1` and `q2` before calling `nlerp()`. The result
+         *            stays within about 0.0001 of `slerp()` without needing
+         *            any trigonometric functions.
+         *
+         *            This function is branch-free, so it works component-wise
+         *            on `quat`'s of SIMD types.
+         *
+         * \tparam T  The component type.
+         *
+         * \param q1  The unit `quat` at `t == 0`.
+         * \param q2  The unit `quat` at `t == 1`.
+         * \param t   The interpolation parameter.
+         *
+         * \return    The interpolated unit `quat`.
+         */
+        template<typename T>
+        inline quat<T> fast_slerp(
+            const quat<T>& q1, const quat<T>& q2, const T& t) noexcept
+        {
+            const auto d = tue::detail_::quat_dot(q1, q2);
+            const auto sign = tue::math::select(
+                tue::math::less(d, T(0.0f)), T(-1.0f), T(1.0f));
+            const auto cos_theta = d * sign;
+
+            const auto a = T(1.0904f) + cos_theta*(T(-3.2452f)
+                + cos_theta*(T(3.55645f) - cos_theta*T(1.43519f)));
+            const auto b = T(0.848013f) + cos_theta*(T(-1.06021f)
+                + cos_theta*T(0.215638f));
+            const auto h = t - T(0.5f);
+            const auto k = a*h*h + b;
+            const auto u = t + t*h*(t - T(1.0f))*k;
+            return tue::detail_::blend_quats(q1, T(1.0f) - u, q2, u * sign);
+        }
+
         /*!@}*/
     }
 }
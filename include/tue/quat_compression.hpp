@@ -0,0 +1,290 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "detail_/float_bits.hpp"
+#include "math.hpp"
+#include "quat.hpp"
+#include "simd.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        template<typename T>
+        struct quat_compression_traits;
+
+        template<>
+        struct quat_compression_traits<float>
+        {
+            using float_type = float;
+            using uint32_type = std::uint32_t;
+            using uint64_type = std::uint64_t;
+
+            static uint32_type float_bits(float x) noexcept
+            {
+                return tue::detail_::float_bits(x);
+            }
+
+            static float bits_float(uint32_type u) noexcept
+            {
+                return tue::detail_::bits_float(u);
+            }
+        };
+
+        template<int N>
+        struct quat_compression_traits<simd<float, N>>
+        {
+            using float_type = simd<float, N>;
+            using uint32_type = simd<std::uint32_t, N>;
+            using uint64_type = simd<std::uint64_t, N>;
+
+            static uint32_type float_bits(const float_type& x) noexcept
+            {
+                return reinterpret_cast<const uint32_type&>(x);
+            }
+
+            static float_type bits_float(const uint32_type& u) noexcept
+            {
+                return reinterpret_cast<const float_type&>(u);
+            }
+        };
+
+        template<>
+        struct quat_compression_traits<std::uint32_t>
+        :
+            quat_compression_traits<float>
+        {
+        };
+
+        template<>
+        struct quat_compression_traits<std::uint64_t>
+        :
+            quat_compression_traits<float>
+        {
+        };
+
+        template<int N>
+        struct quat_compression_traits<simd<std::uint32_t, N>>
+        :
+            quat_compression_traits<simd<float, N>>
+        {
+        };
+
+        template<int N>
+        struct quat_compression_traits<simd<std::uint64_t, N>>
+        :
+            quat_compression_traits<simd<float, N>>
+        {
+        };
+
+        template<int Bits>
+        struct quat_compression_bits
+        {
+            static_assert(Bits == 32 || Bits == 48 || Bits == 64,
+                "Bits must be 32, 48, or 64");
+
+            // 2 bits for the index of the dropped component and the rest
+            // split evenly between the other three.
+            static constexpr int component_bits =
+                Bits == 32 ? 10 : Bits == 48 ? 15 : 20;
+
+            static constexpr std::uint32_t component_mask =
+                (std::uint32_t(1) << component_bits) - 1;
+
+            static constexpr float component_half =
+                float(component_mask >> 1);
+        };
+
+        template<int Bits, typename T>
+        using compressed_quat_t = std::conditional_t<Bits == 32,
+            typename quat_compression_traits<T>::uint32_type,
+            typename quat_compression_traits<T>::uint64_type>;
+
+        // 1/sqrt(2) is the largest magnitude any but the largest component
+        // of a unit quaternion can have.
+        constexpr float smallest_three_range = 0.707106781186547524f;
+
+        template<int Bits, typename T>
+        inline auto quantize_smallest_three(const T& x) noexcept
+        {
+            using traits = quat_compression_traits<T>;
+            using U = typename traits::uint32_type;
+            constexpr auto half = quat_compression_bits<Bits>::component_half;
+
+            // Map [-range, range] to [0, 2*half] so 0 is exactly
+            // representable.
+            auto t = x * T(half / smallest_three_range) + T(half);
+            t = tue::math::min(tue::math::max(t, T(0.0f)), T(2.0f * half));
+
+            // Adding 2^23 rounds to the nearest integer (ties to even) and
+            // leaves it in the low mantissa bits, the same way for scalars
+            // and every simd type.
+            return traits::float_bits(t + T(8388608.0f)) & U(0x7FFFFFu);
+        }
+
+        template<int Bits, typename U>
+        inline auto dequantize_smallest_three(const U& u) noexcept
+        {
+            using traits = quat_compression_traits<U>;
+            using T = typename traits::float_type;
+            constexpr auto half = quat_compression_bits<Bits>::component_half;
+
+            const auto t = traits::bits_float(u | U(0x4B000000u))
+                - T(8388608.0f + half);
+
+            return t * T(smallest_three_range / half);
+        }
+    }
+
+    /*!
+     * \defgroup  quat_compression_hpp <tue/quat_compression.hpp>
+     *
+     * \brief     Functions for compressing rotation quaternions with the
+     *            "smallest three" method.
+     * \details   The largest-magnitude component of a unit quaternion can be
+     *            recovered from the other three, which are each in
+     *            `[-1/sqrt(2), 1/sqrt(2)]`. Since `q` and `-q` represent the
+     *            same rotation, the quaternion is first negated if necessary
+     *            to make the largest component positive. The 2-bit index of
+     *            the dropped component and the other three components
+     *            quantized to `10`, `15`, or `20` bits each are then packed
+     *            into `32`, `48`, or `64` bits.
+     *
+     *            Every component of a decompressed quaternion is within
+     *            `2 / (2^B - 2)` of the original (where `B` is the number of
+     *            bits per component), i.e., about `0.002` for 32 bits,
+     *            `0.00006` for 48 bits, and `0.000002` for 64 bits. The
+     *            identity and other quaternions with components of `0` or
+     *            `1` round trip exactly.
+     * @{
+     */
+
+    /*!
+     * \brief        Compresses a rotation quaternion.
+     * \details      `q` must be normalized (e.g., with
+     *               `tue::math::normalize()`).
+     *
+     * \tparam Bits  The compressed size (in bits). Must be `32`, `48`, or
+     *               `64`. 48-bit values are returned in the low bits of a
+     *               64-bit integer.
+     * \tparam T     The component type of `q`. Must be `float` or a `float`
+     *               `simd` type to compress several quaternions at once.
+     *
+     * \param q      The rotation quaternion to compress.
+     *
+     * \return       The compressed quaternion(s): `std::uint32_t` or
+     *               `std::uint64_t` for `float` and `simd<std::uint32_t, N>`
+     *               or `simd<std::uint64_t, N>` for `simd<float, N>`.
+     */
+    template<int Bits, typename T>
+    inline tue::detail_::compressed_quat_t<Bits, T>
+    compress_quat(const quat<T>& q) noexcept
+    {
+        using traits = tue::detail_::quat_compression_traits<T>;
+        using U = typename traits::uint32_type;
+        using R = tue::detail_::compressed_quat_t<Bits, T>;
+        using layout = tue::detail_::quat_compression_bits<Bits>;
+        constexpr int b = layout::component_bits;
+
+        // Find the largest-magnitude component, preferring the first on ties
+        auto index = U(0u);
+        auto largest = q[0];
+        auto largest_abs = tue::math::abs(q[0]);
+        for (int i = 1; i < 4; ++i)
+        {
+            const auto abs = tue::math::abs(q[i]);
+            const auto gt = tue::math::greater(abs, largest_abs);
+            index = tue::math::select(gt, U(std::uint32_t(i)), index);
+            largest = tue::math::select(gt, q[i], largest);
+            largest_abs = tue::math::select(gt, abs, largest_abs);
+        }
+
+        const auto negate = tue::math::less(largest, T(0.0f));
+
+        R result = R(index);
+        for (int i = 0; i < 3; ++i)
+        {
+            // Skip over the dropped component
+            const auto c = tue::math::select(
+                tue::math::greater(index, U(std::uint32_t(i))),
+                q[i], q[i+1]);
+
+            const auto quantized =
+                tue::detail_::quantize_smallest_three<Bits>(
+                    tue::math::select(negate, -c, c));
+
+            result = (result << b) | R(quantized);
+        }
+
+        return result;
+    }
+
+    /*!
+     * \brief        Decompresses a rotation quaternion compressed with
+     *               `compress_quat()`.
+     *
+     * \tparam Bits  The compressed size (in bits). Must be `32`, `48`, or
+     *               `64`.
+     * \tparam U     The type of `bits`. Must be `std::uint32_t`,
+     *               `std::uint64_t`, `simd<std::uint32_t, N>`, or
+     *               `simd<std::uint64_t, N>` as returned by `compress_quat()`.
+     *
+     * \param bits   The compressed quaternion(s).
+     *
+     * \return       The decompressed rotation quaternion(s) with `float` or
+     *               `simd<float, N>` components.
+     */
+    template<int Bits, typename U>
+    inline quat<typename tue::detail_::quat_compression_traits<U>::float_type>
+    decompress_quat(const U& bits) noexcept
+    {
+        static_assert(
+            std::is_same<U, tue::detail_::compressed_quat_t<Bits, U>>::value,
+            "U doesn't match Bits");
+
+        using traits = tue::detail_::quat_compression_traits<U>;
+        using T = typename traits::float_type;
+        using V = typename traits::uint32_type;
+        using layout = tue::detail_::quat_compression_bits<Bits>;
+        constexpr int b = layout::component_bits;
+        constexpr auto mask = layout::component_mask;
+
+        T c[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            c[i] = tue::detail_::dequantize_smallest_three<Bits>(
+                V((bits >> ((2 - i) * b)) & U(mask)));
+        }
+
+        const auto index = V(bits >> (3 * b));
+        const auto largest = tue::math::sqrt(tue::math::max(
+            T(1.0f) - c[0]*c[0] - c[1]*c[1] - c[2]*c[2], T(0.0f)));
+
+        T result[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            const auto stored = i == 0 ? c[0] : i == 3 ? c[2]
+                : tue::math::select(
+                    tue::math::greater(index, V(std::uint32_t(i))),
+                    c[i], c[i-1]);
+
+            result[i] = tue::math::select(
+                tue::math::equal(index, V(std::uint32_t(i))),
+                largest, stored);
+        }
+
+        return { result[0], result[1], result[2], result[3] };
+    }
+
+    /*!@}*/
+}
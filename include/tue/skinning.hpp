@@ -0,0 +1,329 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mat.hpp"
+#include "math.hpp"
+#include "simd.hpp"
+#include "vec.hpp"
+
+/*!
+ * \defgroup  skinning_hpp <tue/skinning.hpp>
+ *
+ * \brief     Linear blend skinning over vertex streams.
+ * \details   Each vertex has `K` bone influences. Its skinning matrix is the
+ *            weighted sum of its bones' matrices, which then transforms its
+ *            position (as `m * vec4(p, 1)`) and its normal (by the upper-left
+ *            3x3 part, followed by normalization).
+ *
+ *            Vertices are skinned `W` at a time with `simd<float, W>`
+ *            components. The ranged overloads only touch vertices
+ *            `[first, last)` of each stream, so disjoint ranges can be
+ *            skinned on different threads. Positions and normals can also be
+ *            stored as blocks of `W` vertices (`vec3<simd<float, W>>`), in
+ *            which case they're skinned without any shuffling.
+ */
+namespace tue
+{
+    namespace detail_
+    {
+        // Returns the skinning matrices of the n <= W vertices starting at
+        // vertex i. Each influence's bone matrices are gathered into the
+        // lanes of one mat<simd>, and the weighted sum of those is built
+        // with a chain of multiply-adds. Lanes past n stay zero.
+        template<int K, int W>
+        inline mat<simd<float, W>, 4, 3> linear_blend_mat(
+            const mat<float, 4, 3>* bones,
+            const std::uint16_t* indices, const float* weights,
+            std::size_t i, std::size_t n) noexcept
+        {
+            using S = simd<float, W>;
+
+            auto m = mat<S, 4, 3>::zero();
+            for (int k = 0; k < K; ++k)
+            {
+                auto b = mat<S, 4, 3>::zero();
+                auto w = S::zero();
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    const auto v = (i + j) * K + k;
+                    const auto& bone = bones[indices[v]];
+                    for (int c = 0; c < 4; ++c)
+                    {
+                        b[c][0].data()[j] = bone[c][0];
+                        b[c][1].data()[j] = bone[c][1];
+                        b[c][2].data()[j] = bone[c][2];
+                    }
+
+                    w.data()[j] = weights[v];
+                }
+
+                for (int c = 0; c < 4; ++c)
+                {
+                    m[c][0] += b[c][0] * w;
+                    m[c][1] += b[c][1] * w;
+                    m[c][2] += b[c][2] * w;
+                }
+            }
+
+            return m;
+        }
+
+        // Transforms a block of normals by the upper-left 3x3 parts of a
+        // block of skinning matrices and normalizes them
+        template<int W>
+        inline vec3<simd<float, W>> linear_blend_normals(
+            const mat<simd<float, W>, 4, 3>& m,
+            const vec3<simd<float, W>>& nv) noexcept
+        {
+            using S = simd<float, W>;
+
+            auto rn = m[0]*nv[0] + m[1]*nv[1] + m[2]*nv[2];
+            rn *= S(1.0f)
+                / tue::math::sqrt(rn[0]*rn[0] + rn[1]*rn[1] + rn[2]*rn[2]);
+            return rn;
+        }
+
+        // Skins the n <= W vertices starting at vertex i, gathering their
+        // positions and normals into the lanes of a vec3<simd> and
+        // scattering the results back out
+        template<int K, int W>
+        inline void linear_blend_block(
+            const mat<float, 4, 3>* bones,
+            const std::uint16_t* indices, const float* weights,
+            const fvec3* positions, const fvec3* normals,
+            fvec3* out_positions, fvec3* out_normals,
+            std::size_t i, std::size_t n) noexcept
+        {
+            using S = simd<float, W>;
+
+            const auto m = tue::detail_::linear_blend_mat<K, W>(
+                bones, indices, weights, i, n);
+
+            auto p = vec3<S>(S::zero());
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                p[0].data()[j] = positions[i+j][0];
+                p[1].data()[j] = positions[i+j][1];
+                p[2].data()[j] = positions[i+j][2];
+            }
+
+            const auto rp = m[0]*p[0] + m[1]*p[1] + m[2]*p[2] + m[3];
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                out_positions[i+j] = fvec3(
+                    rp[0].data()[j], rp[1].data()[j], rp[2].data()[j]);
+            }
+
+            if (normals == nullptr)
+            {
+                return;
+            }
+
+            auto nv = vec3<S>(S::zero());
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                nv[0].data()[j] = normals[i+j][0];
+                nv[1].data()[j] = normals[i+j][1];
+                nv[2].data()[j] = normals[i+j][2];
+            }
+
+            const auto rn = tue::detail_::linear_blend_normals(m, nv);
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                out_normals[i+j] = fvec3(
+                    rn[0].data()[j], rn[1].data()[j], rn[2].data()[j]);
+            }
+        }
+    }
+
+    namespace skinning
+    {
+        /*!
+         * \addtogroup  skinning_hpp
+         * @{
+         */
+
+        /*!
+         * \brief                Skins the vertices `[first, last)`.
+         *
+         * \tparam K             The number of bone influences per vertex.
+         * \tparam W             The number of vertices skinned at once. Must
+         *                       be 4 or 8. Defaults to 8.
+         *
+         * \param bones          The bone palette. Each matrix transforms
+         *                       from bind pose to posed space.
+         * \param indices        `K` bone indices per vertex.
+         * \param weights        `K` bone weights per vertex, which should
+         *                       add up to 1.
+         * \param positions      The bind pose positions.
+         * \param normals        The bind pose normals. Can be `nullptr` to
+         *                       skip normals.
+         * \param out_positions  Where the skinned positions will be stored.
+         *                       Can be the same as `positions`.
+         * \param out_normals    Where the skinned normals will be stored.
+         *                       Can be the same as `normals`. Ignored if
+         *                       `normals` is `nullptr`.
+         * \param first          The index of the first vertex to skin.
+         * \param last           One past the index of the last vertex to
+         *                       skin.
+         */
+        template<int K, int W = 8>
+        inline void linear_blend(
+            const mat<float, 4, 3>* bones,
+            const std::uint16_t* indices, const float* weights,
+            const fvec3* positions, const fvec3* normals,
+            fvec3* out_positions, fvec3* out_normals,
+            std::size_t first, std::size_t last) noexcept
+        {
+            static_assert(W == 4 || W == 8, "W must be 4 or 8");
+
+            constexpr auto n = std::size_t(W);
+            for (std::size_t i = first; i < last; i += n)
+            {
+                tue::detail_::linear_blend_block<K, W>(
+                    bones, indices, weights, positions, normals,
+                    out_positions, out_normals,
+                    i, last - i < n ? last - i : n);
+            }
+        }
+
+        /*!
+         * \brief                Skins `count` vertices.
+         * \details              See the ranged overload of
+         *                       `linear_blend()`.
+         *
+         * \tparam K             The number of bone influences per vertex.
+         * \tparam W             The number of vertices skinned at once. Must
+         *                       be 4 or 8. Defaults to 8.
+         *
+         * \param bones          The bone palette.
+         * \param indices        `K` bone indices per vertex.
+         * \param weights        `K` bone weights per vertex.
+         * \param positions      The bind pose positions.
+         * \param normals        The bind pose normals. Can be `nullptr`.
+         * \param out_positions  Where the skinned positions will be stored.
+         * \param out_normals    Where the skinned normals will be stored.
+         * \param count          The number of vertices to skin.
+         */
+        template<int K, int W = 8>
+        inline void linear_blend(
+            const mat<float, 4, 3>* bones,
+            const std::uint16_t* indices, const float* weights,
+            const fvec3* positions, const fvec3* normals,
+            fvec3* out_positions, fvec3* out_normals,
+            std::size_t count) noexcept
+        {
+            tue::skinning::linear_blend<K, W>(
+                bones, indices, weights, positions, normals,
+                out_positions, out_normals, 0, count);
+        }
+
+        /*!
+         * \brief                Skins the vertices `[first, last)` of
+         *                       streams stored as blocks of `W` vertices.
+         * \details              Like the other ranged overload of
+         *                       `linear_blend()`, except vertex `i`'s
+         *                       position and normal are in lane `i % W` of
+         *                       block `i / W`, so they're used and stored
+         *                       without any shuffling. Lanes past `last` in
+         *                       its block are left unspecified.
+         *
+         * \tparam K             The number of bone influences per vertex.
+         * \tparam W             The number of vertices in each block. Must
+         *                       be 4 or 8.
+         *
+         * \param bones          The bone palette.
+         * \param indices        `K` bone indices per vertex.
+         * \param weights        `K` bone weights per vertex.
+         * \param positions      The bind pose position blocks.
+         * \param normals        The bind pose normal blocks. Can be
+         *                       `nullptr` to skip normals.
+         * \param out_positions  Where the skinned position blocks will be
+         *                       stored. Can be the same as `positions`.
+         * \param out_normals    Where the skinned normal blocks will be
+         *                       stored. Can be the same as `normals`.
+         *                       Ignored if `normals` is `nullptr`.
+         * \param first          The index of the first vertex to skin.
+         *                       Must be a multiple of `W`.
+         * \param last           One past the index of the last vertex to
+         *                       skin.
+         */
+        template<int K, int W>
+        inline void linear_blend(
+            const mat<float, 4, 3>* bones,
+            const std::uint16_t* indices, const float* weights,
+            const vec3<simd<float, W>>* positions,
+            const vec3<simd<float, W>>* normals,
+            vec3<simd<float, W>>* out_positions,
+            vec3<simd<float, W>>* out_normals,
+            std::size_t first, std::size_t last) noexcept
+        {
+            static_assert(W == 4 || W == 8, "W must be 4 or 8");
+
+            constexpr auto n = std::size_t(W);
+            for (std::size_t i = first; i < last; i += n)
+            {
+                const auto m = tue::detail_::linear_blend_mat<K, W>(
+                    bones, indices, weights,
+                    i, last - i < n ? last - i : n);
+
+                const auto& p = positions[i/n];
+                out_positions[i/n] = m[0]*p[0] + m[1]*p[1] + m[2]*p[2] + m[3];
+                if (normals != nullptr)
+                {
+                    out_normals[i/n] =
+                        tue::detail_::linear_blend_normals(m, normals[i/n]);
+                }
+            }
+        }
+
+        /*!
+         * \brief                Skins `count` vertices of streams stored as
+         *                       blocks of `W` vertices.
+         * \details              See the ranged overload of
+         *                       `linear_blend()` for blocks.
+         *
+         * \tparam K             The number of bone influences per vertex.
+         * \tparam W             The number of vertices in each block. Must
+         *                       be 4 or 8.
+         *
+         * \param bones          The bone palette.
+         * \param indices        `K` bone indices per vertex.
+         * \param weights        `K` bone weights per vertex.
+         * \param positions      The bind pose position blocks.
+         * \param normals        The bind pose normal blocks. Can be
+         *                       `nullptr`.
+         * \param out_positions  Where the skinned position blocks will be
+         *                       stored.
+         * \param out_normals    Where the skinned normal blocks will be
+         *                       stored.
+         * \param count          The number of vertices to skin.
+         */
+        template<int K, int W>
+        inline void linear_blend(
+            const mat<float, 4, 3>* bones,
+            const std::uint16_t* indices, const float* weights,
+            const vec3<simd<float, W>>* positions,
+            const vec3<simd<float, W>>* normals,
+            vec3<simd<float, W>>* out_positions,
+            vec3<simd<float, W>>* out_normals,
+            std::size_t count) noexcept
+        {
+            tue::skinning::linear_blend<K, W>(
+                bones, indices, weights, positions, normals,
+                out_positions, out_normals, 0, count);
+        }
+
+        /*!@}*/
+    }
+}
@@ -8,12 +8,15 @@
 
 #pragma once
 
+#include <cmath>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
 #include "mat.hpp"
 #include "math.hpp"
 #include "quat.hpp"
+#include "simd.hpp"
 #include "vec.hpp"
 
 /*!
@@ -76,6 +79,202 @@
  */
 namespace tue
 {
+    namespace detail_
+    {
+        // The number of vectors transformed at once by the batch functions
+        constexpr int transform_block_size = 8;
+
+        using transform_block_type = simd<float, transform_block_size>;
+
+        inline const fvec3& transform_element(
+            const fvec3* data, std::size_t stride, std::size_t i) noexcept
+        {
+            return *reinterpret_cast<const fvec3*>(
+                reinterpret_cast<const unsigned char*>(data) + i * stride);
+        }
+
+        inline fvec3& transform_element(
+            fvec3* data, std::size_t stride, std::size_t i) noexcept
+        {
+            return *reinterpret_cast<fvec3*>(
+                reinterpret_cast<unsigned char*>(data) + i * stride);
+        }
+
+        template<typename T, int C>
+        inline constexpr vec3<T> transform_affine(
+            const mat<T, C, 4>& m, const vec4<T>& v) noexcept
+        {
+            return v * mat<T, 3, 4>(m);
+        }
+
+        template<typename T>
+        inline constexpr vec3<T> transform_affine(
+            const mat<T, 4, 3>& m, const vec4<T>& v) noexcept
+        {
+            return m * v;
+        }
+
+        template<typename T>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        atan2_m(const T& y, const T& x) noexcept
+        {
+            return std::atan2(y, x);
+        }
+
+        // A branch-free atan2() for simd types. After reducing to an angle
+        // in [0, pi/8], this uses the same polynomial as Cephes' atanf(),
+        // so it's accurate to about float precision.
+        template<typename T>
+        inline std::enable_if_t<!std::is_arithmetic<T>::value, T>
+        atan2_m(const T& y, const T& x) noexcept
+        {
+            const auto ax = tue::math::abs(x);
+            const auto ay = tue::math::abs(y);
+            const auto mx = tue::math::max(ax, ay);
+            const auto mn = tue::math::min(ax, ay);
+            const auto nonzero = tue::math::greater(mx, T(0.0f));
+            const auto t = mn / tue::math::select(nonzero, mx, T(1.0f));
+
+            // atan(t) = pi/4 + atan((t - 1) / (t + 1))
+            const auto big = tue::math::greater(t, T(0.414213562373095f));
+            const auto u = tue::math::select(
+                big, (t - T(1.0f)) / (t + T(1.0f)), t);
+            const auto z = u * u;
+            auto r = u + u * z * (T(-3.33329491539e-1f)
+                + z * (T(1.99777106478e-1f)
+                + z * (T(-1.38776856032e-1f)
+                + z * T(8.05374449538e-2f))));
+            r += tue::math::select(
+                big, T(0.785398163397448f), T(0.0f));
+
+            r = tue::math::select(
+                tue::math::greater(ay, ax), T(1.57079632679490f) - r, r);
+            r = tue::math::select(
+                tue::math::less(x, T(0.0f)), T(3.14159265358979f) - r, r);
+            return tue::math::select(tue::math::less(y, T(0.0f)), -r, r);
+        }
+
+        // Computes the unit quat q whose rotation_mat(q) is the 3x3 rotation
+        // matrix a. Shepperd's method picks whichever of the four components
+        // is largest to divide by, selected without branches so it only
+        // needs one square root.
+        template<typename T>
+        inline quat<T> rotation_quat_m(const mat<T, 3, 3>& a) noexcept
+        {
+            // rotation_mat(q) is the usual column-vector matrix of the
+            // conjugate of q, so this finds that quat p and conjugates it.
+            const auto d21 = a[1][2] - a[2][1];
+            const auto d02 = a[2][0] - a[0][2];
+            const auto d10 = a[0][1] - a[1][0];
+            const auto s01 = a[1][0] + a[0][1];
+            const auto s02 = a[2][0] + a[0][2];
+            const auto s12 = a[2][1] + a[1][2];
+
+            const T t[4] = {
+                T(1.0f) + a[0][0] - a[1][1] - a[2][2],
+                T(1.0f) - a[0][0] + a[1][1] - a[2][2],
+                T(1.0f) - a[0][0] - a[1][1] + a[2][2],
+                T(1.0f) + a[0][0] + a[1][1] + a[2][2],
+            };
+
+            const vec4<T> p[4] = {
+                { t[0], s01, s02, d21 },
+                { s01, t[1], s12, d02 },
+                { s02, s12, t[2], d10 },
+                { d21, d02, d10, t[3] },
+            };
+
+            auto best_t = t[3];
+            auto best_p = p[3];
+            for (int k = 0; k < 3; ++k)
+            {
+                const auto better = tue::math::greater(t[k], best_t);
+                best_t = tue::math::select(better, t[k], best_t);
+                for (int i = 0; i < 4; ++i)
+                {
+                    best_p[i] = tue::math::select(better, p[k][i], best_p[i]);
+                }
+            }
+
+            const auto s = T(0.5f) / tue::math::sqrt(best_t);
+            return { -best_p[0]*s, -best_p[1]*s, -best_p[2]*s, best_p[3]*s };
+        }
+
+        // Transforms the vectors in blocks of 8 with the same simd kernel,
+        // padding the last block with zeros. Each block is fully loaded
+        // before it's stored, so src and dst can be the same.
+        template<typename F>
+        inline void transform_n(
+            const fvec3* src, std::size_t src_stride, std::size_t count,
+            fvec3* dst, std::size_t dst_stride, const F& f) noexcept
+        {
+            using S = transform_block_type;
+            constexpr auto n = std::size_t(transform_block_size);
+
+            for (std::size_t i = 0; i < count; i += n)
+            {
+                const auto m = count - i < n ? count - i : n;
+
+                vec3<S> v(S::zero());
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    const auto& e = tue::detail_::transform_element(
+                        src, src_stride, i+j);
+                    v[0].data()[j] = e[0];
+                    v[1].data()[j] = e[1];
+                    v[2].data()[j] = e[2];
+                }
+
+                const vec3<S> r = f(v);
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    auto& e = tue::detail_::transform_element(
+                        dst, dst_stride, i+j);
+                    e = fvec3(r[0].data()[j], r[1].data()[j], r[2].data()[j]);
+                }
+            }
+        }
+
+        // v * m for the upper-left 3x3 part of m
+        template<int C, int R>
+        inline vec3<transform_block_type> transform_block_vectors(
+            const mat<transform_block_type, C, R>& m,
+            const vec3<transform_block_type>& v) noexcept
+        {
+            return {
+                v[0] * m[0][0] + v[1] * m[0][1] + v[2] * m[0][2],
+                v[0] * m[1][0] + v[1] * m[1][1] + v[2] * m[1][2],
+                v[0] * m[2][0] + v[1] * m[2][1] + v[2] * m[2][2],
+            };
+        }
+
+        // The upper-left 3x3 part of m in the form that's applied to row
+        // vectors. A mat4x3 is the transpose of a mat3x4, so its part is
+        // transposed back.
+        template<int C, int R>
+        inline mat<float, 3, 3> row_vector_part(
+            const mat<float, C, R>& m) noexcept
+        {
+            return mat<float, 3, 3>(m);
+        }
+
+        inline mat<float, 3, 3> row_vector_part(
+            const mat<float, 4, 3>& m) noexcept
+        {
+            return tue::detail_::transpose_m(mat<float, 3, 3>(m));
+        }
+
+        // vec4(v, 1) * m for the first 3 columns of m
+        template<int C>
+        inline vec3<transform_block_type> transform_block_points(
+            const mat<transform_block_type, C, 4>& m,
+            const vec3<transform_block_type>& v) noexcept
+        {
+            return tue::detail_::transform_block_vectors(m, v)
+                + vec3<transform_block_type>(m[0][3], m[1][3], m[2][3]);
+        }
+    }
+
     namespace transform
     {
         /*!
@@ -132,6 +331,82 @@ namespace tue
             return tue::transform::axis_angle(v[0], v[1], v[2]);
         }
 
+        /*!
+         * \brief     Converts a rotation quaternion to an axis-angle vector.
+         * \details   The angle is in the range `[0, 2pi]`. If `q` is the
+         *            identity, returns `(0, 0, 1, 0)`.
+         *
+         *            This function is branch-free, so it works component-wise
+         *            on `quat`'s of SIMD types.
+         *
+         * \tparam T  The rotation quaternion's component type.
+         *
+         * \param q   The rotation quaternion. Must be normalized.
+         *
+         * \return    The axis-angle vector.
+         */
+        template<typename T>
+        inline vec4<T> axis_angle(const quat<T>& q) noexcept
+        {
+            const auto length2 = q[0]*q[0] + q[1]*q[1] + q[2]*q[2];
+            const auto nonzero = tue::math::greater(length2, T(0));
+            const auto length = tue::math::sqrt(length2);
+            const auto rlength = T(1)
+                / tue::math::select(nonzero, length, T(1));
+
+            return {
+                tue::math::select(nonzero, q[0] * rlength, T(0)),
+                tue::math::select(nonzero, q[1] * rlength, T(0)),
+                tue::math::select(nonzero, q[2] * rlength, T(1)),
+                T(2) * tue::detail_::atan2_m(length, q[3]),
+            };
+        }
+
+        /*!
+         * \brief     Converts a rotation quaternion to Euler angles.
+         * \details   The returned angles `(x, y, z)` are rotations around the
+         *            `x`, `y`, and `z` axes applied in that order. In other
+         *            words, `rotation_mat(q)` is the same as
+         *
+         *            \code
+         *            rotation_mat(T(1), T(0), T(0), x)
+         *                * rotation_mat(T(0), T(1), T(0), y)
+         *                * rotation_mat(T(0), T(0), T(1), z)
+         *            \endcode
+         *
+         *            `x` and `z` are in the range `[-pi, pi]` and `y` is in
+         *            the range `[-pi/2, pi/2]`.
+         *
+         *            This function is branch-free, so it works component-wise
+         *            on `quat`'s of SIMD types.
+         *
+         * \tparam T  The rotation quaternion's component type.
+         *
+         * \param q   The rotation quaternion. Must be normalized.
+         *
+         * \return    The Euler angles.
+         */
+        template<typename T>
+        inline vec3<T> euler_angles(const quat<T>& q) noexcept
+        {
+            const auto x = q[0];
+            const auto y = q[1];
+            const auto z = q[2];
+            const auto w = q[3];
+
+            const auto sin_y = tue::math::max(T(-1),
+                tue::math::min(T(1), T(2) * (w*y - z*x)));
+
+            return {
+                tue::detail_::atan2_m(
+                    T(2) * (w*x + y*z), T(1) - T(2) * (x*x + y*y)),
+                tue::detail_::atan2_m(
+                    sin_y, tue::math::sqrt(T(1) - sin_y*sin_y)),
+                tue::detail_::atan2_m(
+                    T(2) * (w*z + x*y), T(1) - T(2) * (y*y + z*z)),
+            };
+        }
+
         /*!
          * \brief         Converts an axis-angle pair to a rotation vector.
          * \details       This function assumes the axis is normalized.
@@ -296,6 +571,31 @@ namespace tue
                 tue::transform::axis_angle(v));
         }
 
+        /*!
+         * \brief     Converts a rotation matrix to a rotation quaternion.
+         * \details   Only the upper-left 3x3 part of `m` is used. The result
+         *            `q` is normalized and `rotation_mat(q)` is `m` again.
+         *
+         *            Shepperd's method is used for numerical stability. It's
+         *            branch-free, so this works component-wise on `mat`'s of
+         *            SIMD types.
+         *
+         * \tparam T  The rotation matrix's component type.
+         * \tparam C  The rotation matrix's column count.
+         * \tparam R  The rotation matrix's row count.
+         *
+         * \param m   The rotation matrix (e.g., as returned by
+         *            `rotation_mat()`). Must be orthonormal.
+         *
+         * \return    The rotation quaternion.
+         */
+        template<typename T, int C, int R>
+        inline std::enable_if_t<(C >= 3 && R >= 3), quat<T>>
+        rotation_quat(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::rotation_quat_m(mat<T, 3, 3>(m));
+        }
+
         /*!
          * \brief     Computes a 2D translation matrix.
          * \details   The returned matrix might be the transpose of what you
@@ -865,6 +1165,113 @@ namespace tue
             return tue::transform::scale_mat<T, C, R>(v[0], v[1], v[2]);
         }
 
+        /*!
+         * \brief     Computes a 3D scale, rotation, and translation matrix.
+         * \details   The result is the same as
+         *            `scale_mat(s) * rotation_mat(q) * translation_mat(t)`
+         *            (i.e., vectors are scaled, then rotated, then
+         *            translated), but it's written out directly instead of
+         *            building and multiplying three matrices.
+         *            <br/>
+         *            `T` can be a `simd` type to compute several matrices at
+         *            once.
+         *
+         * \tparam T  The component type of `t`, `q`, and `s`.
+         * \tparam C  The column count of the returned matrix.
+         *            Must be 3 or 4. Defaults to 4.
+         * \tparam R  The row count of the returned matrix.
+         *            Must be 4. Defaults to 4.
+         *
+         * \param t   The translation vector.
+         * \param q   The rotation quaternion. Must be normalized.
+         * \param s   The scale vector.
+         *
+         * \return    A 3D scale, rotation, and translation matrix. Values
+         *            beyond the requested matrix dimensions are truncated.
+         *
+         *            \code
+         *            // Where r is rotation_mat<T, 3, 3>(q) written out the
+         *            // same way.
+         *
+         *            [ s[0]*r00,  s[0]*r01,  s[0]*r02,  0 ]
+         *            [ s[1]*r10,  s[1]*r11,  s[1]*r12,  0 ]
+         *            [ s[2]*r20,  s[2]*r21,  s[2]*r22,  0 ]
+         *            [     t[0],      t[1],      t[2],  1 ]
+         *            \endcode
+         */
+        template<typename T, int C = 4, int R = 4>
+        inline constexpr std::enable_if_t<(C >= 3 && R >= 4), mat<T, C, R>>
+        trs_mat(const vec3<T>& t, const quat<T>& q, const vec3<T>& s)
+            noexcept
+        {
+            return tue::detail_::mat_utils<T, C, R>::create(
+                s[0] * (T(1) - T(2)*q[1]*q[1] - T(2)*q[2]*q[2]),
+                s[1] * (       T(2)*q[0]*q[1] - T(2)*q[2]*q[3]),
+                s[2] * (       T(2)*q[0]*q[2] + T(2)*q[1]*q[3]),
+                t[0],
+                s[0] * (       T(2)*q[0]*q[1] + T(2)*q[2]*q[3]),
+                s[1] * (T(1) - T(2)*q[0]*q[0] - T(2)*q[2]*q[2]),
+                s[2] * (       T(2)*q[1]*q[2] - T(2)*q[0]*q[3]),
+                t[1],
+                s[0] * (       T(2)*q[0]*q[2] - T(2)*q[1]*q[3]),
+                s[1] * (       T(2)*q[1]*q[2] + T(2)*q[0]*q[3]),
+                s[2] * (T(1) - T(2)*q[0]*q[0] - T(2)*q[1]*q[1]),
+                t[2],
+                0, 0, 0, 1);
+        }
+
+        /*!
+         * \brief     Splits a scale, rotation, and translation matrix into
+         *            its parts.
+         * \details   The inverse of `trs_mat()`: `trs_mat(t, q, s)` is `m`
+         *            again (to within rounding). The scale is the length of
+         *            each of the first three rows, and if the upper-left 3x3
+         *            part of `m` has a negative determinant every component
+         *            of the scale is negated so that the rest is a rotation.
+         *            Any shear is lost.
+         *            <br/>
+         *            Everything is branch-free, so `T` can be a `simd` type
+         *            to decompose several matrices at once.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`. Must be 3 or 4.
+         * \tparam R  The row count of `m`. Must be 4.
+         *
+         * \param m   The matrix. Must have a nonzero scale along every
+         *            axis.
+         * \param t   Where the translation vector will be stored.
+         * \param q   Where the normalized rotation quaternion will be
+         *            stored.
+         * \param s   Where the scale vector will be stored.
+         */
+        template<typename T, int C, int R>
+        inline std::enable_if_t<(C >= 3 && R >= 4)> decompose_trs(
+            const mat<T, C, R>& m, vec3<T>& t, quat<T>& q, vec3<T>& s)
+            noexcept
+        {
+            t = vec3<T>(m[0][3], m[1][3], m[2][3]);
+
+            mat<T, 3, 3> a(m);
+            const auto det =
+                a[0][0] * (a[1][1]*a[2][2] - a[2][1]*a[1][2])
+                - a[1][0] * (a[0][1]*a[2][2] - a[2][1]*a[0][2])
+                + a[2][0] * (a[0][1]*a[1][2] - a[1][1]*a[0][2]);
+            const auto sign = tue::math::select(
+                tue::math::less(det, T(0.0f)), T(-1.0f), T(1.0f));
+
+            for (int r = 0; r < 3; ++r)
+            {
+                s[r] = sign * tue::math::sqrt(
+                    a[0][r]*a[0][r] + a[1][r]*a[1][r] + a[2][r]*a[2][r]);
+                const auto rs = T(1.0f) / s[r];
+                a[0][r] *= rs;
+                a[1][r] *= rs;
+                a[2][r] *= rs;
+            }
+
+            q = tue::detail_::rotation_quat_m(a);
+        }
+
         /*!
          * \brief         Computes a 3D perspective matrix.
          * \details       The returned matrix might be the transpose of what you
@@ -963,6 +1370,485 @@ namespace tue
                 0, 0, 0,                    1);
         }
 
+        /*!
+         * \brief     Transforms a point by an affine transformation matrix.
+         * \details   `p` is transformed as `vec4(p, 1) * m`, ignoring the last
+         *            column of a `mat4x4`. A `mat4x3` is the transpose of a
+         *            `mat3x4`, so `p` is transformed as `m * vec4(p, 1)`
+         *            instead. Either way, translations are applied.
+         *
+         * \tparam T  The component type of `m` and `p`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   An affine transformation matrix. Must be a `mat3x4`,
+         *            `mat4x3`, or `mat4x4`.
+         * \param p   The point to transform.
+         *
+         * \return    The transformed point.
+         */
+        template<typename T, int C, int R>
+        inline constexpr std::enable_if_t<
+            (C == 3 && R == 4) || (C == 4 && R == 3) || (C == 4 && R == 4),
+            vec3<T>>
+        transform_point(const mat<T, C, R>& m, const vec3<T>& p) noexcept
+        {
+            return tue::detail_::transform_affine(m, vec4<T>(p, T(1)));
+        }
+
+        /*!
+         * \brief     Transforms a direction vector by an affine transformation
+         *            matrix.
+         * \details   This is the same as `transform_point()` except that
+         *            translations have no effect.
+         *
+         * \tparam T  The component type of `m` and `v`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   An affine transformation matrix. Must be a `mat3x4`,
+         *            `mat4x3`, or `mat4x4`.
+         * \param v   The direction vector to transform.
+         *
+         * \return    The transformed direction vector.
+         */
+        template<typename T, int C, int R>
+        inline constexpr std::enable_if_t<
+            (C == 3 && R == 4) || (C == 4 && R == 3) || (C == 4 && R == 4),
+            vec3<T>>
+        transform_vector(const mat<T, C, R>& m, const vec3<T>& v) noexcept
+        {
+            return tue::detail_::transform_affine(m, vec4<T>(v, T(0)));
+        }
+
+        /*!
+         * \brief             Transforms `count` points by `m`.
+         * \details           Each point `p` is transformed as `vec4(p, 1) *
+         *                    m`, ignoring the last column of a `mat4x4`
+         *                    (i.e., `m` must be affine; see `project_points()`
+         *                    otherwise). The points are transformed eight at a
+         *                    time as `vec3<float32x8>`'s.
+         *
+         * \tparam C          The column count of `m`. Must be 3 or 4.
+         *
+         * \param m           The transformation matrix (e.g., as returned by
+         *                    `translation_mat()`).
+         * \param src         A pointer to the first point to transform.
+         * \param src_stride  The distance (in bytes) between consecutive
+         *                    points in `src`.
+         * \param count       The number of points to transform.
+         * \param dst         A pointer to where the first transformed point
+         *                    will be stored. Can be the same as `src` if
+         *                    `dst_stride` is the same as `src_stride`.
+         * \param dst_stride  The distance (in bytes) between consecutive
+         *                    points in `dst`.
+         */
+        template<int C>
+        inline std::enable_if_t<(C == 3 || C == 4)> transform_points(
+            const mat<float, C, 4>& m,
+            const fvec3* src, std::size_t src_stride, std::size_t count,
+            fvec3* dst, std::size_t dst_stride) noexcept
+        {
+            using S = tue::detail_::transform_block_type;
+            const auto ms = mat<S, C, 4>(m);
+            tue::detail_::transform_n(
+                src, src_stride, count, dst, dst_stride,
+                [&ms](const vec3<S>& v) noexcept
+                {
+                    return tue::detail_::transform_block_points(ms, v);
+                });
+        }
+
+        /*!
+         * \brief        Transforms `count` contiguous points by `m`.
+         * \details      See the strided overload of `transform_points()`.
+         *
+         * \tparam C     The column count of `m`. Must be 3 or 4.
+         *
+         * \param m      The transformation matrix.
+         * \param src    A pointer to the points to transform.
+         * \param count  The number of points to transform.
+         * \param dst    A pointer to where the transformed points will be
+         *               stored. Can be the same as `src`.
+         */
+        template<int C>
+        inline std::enable_if_t<(C == 3 || C == 4)> transform_points(
+            const mat<float, C, 4>& m,
+            const fvec3* src, std::size_t count, fvec3* dst) noexcept
+        {
+            tue::transform::transform_points(
+                m, src, sizeof(fvec3), count, dst, sizeof(fvec3));
+        }
+
+        /*!
+         * \brief             Rotates `count` points by `q` and then
+         *                    translates them by `t`.
+         * \details           Each point `p` is transformed to `p * q + t`.
+         *                    `q` is converted to a matrix first, so this is as
+         *                    fast as the matrix overload.
+         *
+         * \param q           The rotation quaternion. Must be normalized.
+         * \param t           The translation.
+         * \param src         A pointer to the first point to transform.
+         * \param src_stride  The distance (in bytes) between consecutive
+         *                    points in `src`.
+         * \param count       The number of points to transform.
+         * \param dst         A pointer to where the first transformed point
+         *                    will be stored.
+         * \param dst_stride  The distance (in bytes) between consecutive
+         *                    points in `dst`.
+         */
+        inline void transform_points(
+            const fquat& q, const fvec3& t,
+            const fvec3* src, std::size_t src_stride, std::size_t count,
+            fvec3* dst, std::size_t dst_stride) noexcept
+        {
+            // v * rotation_mat(q) rotates by the inverse of v * q
+            auto m = tue::transform::rotation_mat<float, 3, 4>(
+                tue::math::conjugate(q));
+            m[0][3] = t[0];
+            m[1][3] = t[1];
+            m[2][3] = t[2];
+            tue::transform::transform_points(
+                m, src, src_stride, count, dst, dst_stride);
+        }
+
+        /*!
+         * \brief        Rotates `count` contiguous points by `q` and then
+         *               translates them by `t`.
+         *
+         * \param q      The rotation quaternion. Must be normalized.
+         * \param t      The translation.
+         * \param src    A pointer to the points to transform.
+         * \param count  The number of points to transform.
+         * \param dst    A pointer to where the transformed points will be
+         *               stored. Can be the same as `src`.
+         */
+        inline void transform_points(
+            const fquat& q, const fvec3& t,
+            const fvec3* src, std::size_t count, fvec3* dst) noexcept
+        {
+            tue::transform::transform_points(
+                q, t, src, sizeof(fvec3), count, dst, sizeof(fvec3));
+        }
+
+        /*!
+         * \brief             Transforms `count` direction vectors by `m`.
+         * \details           Each vector `v` is transformed as `v * m3x3`
+         *                    where `m3x3` is the upper-left 3x3 part of `m`,
+         *                    so translations have no effect. A `mat4x3` is
+         *                    the transpose of a `mat3x4`, so `v` is
+         *                    transformed as `m3x3 * v` instead, the same as
+         *                    with `transform_vector()`.
+         *
+         * \tparam C          The column count of `m`. Must be 3 or 4.
+         * \tparam R          The row count of `m`. Must be 3 or 4.
+         *
+         * \param m           The transformation matrix.
+         * \param src         A pointer to the first vector to transform.
+         * \param src_stride  The distance (in bytes) between consecutive
+         *                    vectors in `src`.
+         * \param count       The number of vectors to transform.
+         * \param dst         A pointer to where the first transformed vector
+         *                    will be stored.
+         * \param dst_stride  The distance (in bytes) between consecutive
+         *                    vectors in `dst`.
+         */
+        template<int C, int R>
+        inline std::enable_if_t<(C >= 3 && R >= 3)> transform_vectors(
+            const mat<float, C, R>& m,
+            const fvec3* src, std::size_t src_stride, std::size_t count,
+            fvec3* dst, std::size_t dst_stride) noexcept
+        {
+            using S = tue::detail_::transform_block_type;
+            const auto ms = mat<S, 3, 3>(tue::detail_::row_vector_part(m));
+            tue::detail_::transform_n(
+                src, src_stride, count, dst, dst_stride,
+                [&ms](const vec3<S>& v) noexcept
+                {
+                    return tue::detail_::transform_block_vectors(ms, v);
+                });
+        }
+
+        /*!
+         * \brief        Transforms `count` contiguous direction vectors by
+         *               `m`.
+         * \details      See the strided overload of `transform_vectors()`.
+         *
+         * \tparam C     The column count of `m`. Must be 3 or 4.
+         * \tparam R     The row count of `m`. Must be 3 or 4.
+         *
+         * \param m      The transformation matrix.
+         * \param src    A pointer to the vectors to transform.
+         * \param count  The number of vectors to transform.
+         * \param dst    A pointer to where the transformed vectors will be
+         *               stored. Can be the same as `src`.
+         */
+        template<int C, int R>
+        inline std::enable_if_t<(C >= 3 && R >= 3)> transform_vectors(
+            const mat<float, C, R>& m,
+            const fvec3* src, std::size_t count, fvec3* dst) noexcept
+        {
+            tue::transform::transform_vectors(
+                m, src, sizeof(fvec3), count, dst, sizeof(fvec3));
+        }
+
+        /*!
+         * \brief             Rotates `count` direction vectors by `q`.
+         *
+         * \param q           The rotation quaternion. Must be normalized.
+         * \param src         A pointer to the first vector to transform.
+         * \param src_stride  The distance (in bytes) between consecutive
+         *                    vectors in `src`.
+         * \param count       The number of vectors to transform.
+         * \param dst         A pointer to where the first transformed vector
+         *                    will be stored.
+         * \param dst_stride  The distance (in bytes) between consecutive
+         *                    vectors in `dst`.
+         */
+        inline void transform_vectors(
+            const fquat& q,
+            const fvec3* src, std::size_t src_stride, std::size_t count,
+            fvec3* dst, std::size_t dst_stride) noexcept
+        {
+            tue::transform::transform_vectors(
+                tue::transform::rotation_mat<float, 3, 3>(
+                    tue::math::conjugate(q)),
+                src, src_stride, count, dst, dst_stride);
+        }
+
+        /*!
+         * \brief        Rotates `count` contiguous direction vectors by `q`.
+         *
+         * \param q      The rotation quaternion. Must be normalized.
+         * \param src    A pointer to the vectors to transform.
+         * \param count  The number of vectors to transform.
+         * \param dst    A pointer to where the transformed vectors will be
+         *               stored. Can be the same as `src`.
+         */
+        inline void transform_vectors(
+            const fquat& q,
+            const fvec3* src, std::size_t count, fvec3* dst) noexcept
+        {
+            tue::transform::transform_vectors(
+                q, src, sizeof(fvec3), count, dst, sizeof(fvec3));
+        }
+
+        /*!
+         * \brief        Rotates each of `count` contiguous direction vectors
+         *               by its own rotation quaternion.
+         * \details      Each vector `src[i]` is rotated to
+         *               `math::rotate(src[i], qs[i])`. The vectors are
+         *               rotated eight at a time as `vec3<float32x8>`'s.
+         *
+         * \param qs     A pointer to the rotation quaternions. Each must be
+         *               normalized.
+         * \param src    A pointer to the vectors to transform.
+         * \param count  The number of vectors to transform.
+         * \param dst    A pointer to where the transformed vectors will be
+         *               stored. Can be the same as `src`.
+         */
+        inline void transform_vectors(
+            const fquat* qs,
+            const fvec3* src, std::size_t count, fvec3* dst) noexcept
+        {
+            using S = tue::detail_::transform_block_type;
+            constexpr auto n = std::size_t(tue::detail_::transform_block_size);
+
+            for (std::size_t i = 0; i < count; i += n)
+            {
+                const auto m = count - i < n ? count - i : n;
+
+                quat<S> q(S::zero(), S::zero(), S::zero(), S::zero());
+                vec3<S> v(S::zero());
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        q[k].data()[j] = qs[i+j][k];
+                        v[k].data()[j] = src[i+j][k];
+                    }
+
+                    q[3].data()[j] = qs[i+j][3];
+                }
+
+                const auto r = tue::math::rotate(v, q);
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    dst[i+j] = fvec3(
+                        r[0].data()[j], r[1].data()[j], r[2].data()[j]);
+                }
+            }
+        }
+
+        /*!
+         * \brief        Rotates `count` contiguous blocks of eight direction
+         *               vectors by `q`.
+         *
+         * \param q      The rotation quaternion. Must be normalized.
+         * \param src    A pointer to the vectors to transform.
+         * \param count  The number of `vec3<float32x8>`'s to transform.
+         * \param dst    A pointer to where the transformed vectors will be
+         *               stored. Can be the same as `src`.
+         */
+        inline void transform_vectors(
+            const fquat& q,
+            const vec3<simd<float, 8>>* src, std::size_t count,
+            vec3<simd<float, 8>>* dst) noexcept
+        {
+            using S = simd<float, 8>;
+            const auto ms = mat<S, 3, 3>(
+                tue::transform::rotation_mat<float, 3, 3>(
+                    tue::math::conjugate(q)));
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                dst[i] = tue::detail_::transform_block_vectors(ms, src[i]);
+            }
+        }
+
+        /*!
+         * \brief        Rotates each of `count` contiguous blocks of eight
+         *               direction vectors by its own block of eight rotation
+         *               quaternions.
+         *
+         * \param qs     A pointer to the rotation quaternions. Each must be
+         *               normalized.
+         * \param src    A pointer to the vectors to transform.
+         * \param count  The number of `vec3<float32x8>`'s to transform.
+         * \param dst    A pointer to where the transformed vectors will be
+         *               stored. Can be the same as `src`.
+         */
+        inline void transform_vectors(
+            const quat<simd<float, 8>>* qs,
+            const vec3<simd<float, 8>>* src, std::size_t count,
+            vec3<simd<float, 8>>* dst) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                dst[i] = tue::math::rotate(src[i], qs[i]);
+            }
+        }
+
+        /*!
+         * \brief             Transforms `count` surface normals by `m`.
+         * \details           Each normal is transformed by the inverse
+         *                    transpose of the upper-left 3x3 part of `m` (so
+         *                    it stays perpendicular to transformed surfaces
+         *                    under non-uniform scaling) and then normalized.
+         *                    Zero-length normals become NaN's. Like with
+         *                    `transform_vectors()`, a `mat4x3` is applied to
+         *                    column vectors.
+         *
+         * \tparam C          The column count of `m`. Must be 3 or 4.
+         * \tparam R          The row count of `m`. Must be 3 or 4.
+         *
+         * \param m           The transformation matrix. Its upper-left 3x3
+         *                    part must be invertible.
+         * \param src         A pointer to the first normal to transform.
+         * \param src_stride  The distance (in bytes) between consecutive
+         *                    normals in `src`.
+         * \param count       The number of normals to transform.
+         * \param dst         A pointer to where the first transformed normal
+         *                    will be stored.
+         * \param dst_stride  The distance (in bytes) between consecutive
+         *                    normals in `dst`.
+         */
+        template<int C, int R>
+        inline std::enable_if_t<(C >= 3 && R >= 3)> transform_normals(
+            const mat<float, C, R>& m,
+            const fvec3* src, std::size_t src_stride, std::size_t count,
+            fvec3* dst, std::size_t dst_stride) noexcept
+        {
+            using S = tue::detail_::transform_block_type;
+            const auto ms = mat<S, 3, 3>(tue::math::transpose(
+                tue::math::inverse(tue::detail_::row_vector_part(m))));
+            tue::detail_::transform_n(
+                src, src_stride, count, dst, dst_stride,
+                [&ms](const vec3<S>& v) noexcept
+                {
+                    const auto n =
+                        tue::detail_::transform_block_vectors(ms, v);
+                    return n * (S(1.0f) / tue::math::sqrt(
+                        n[0] * n[0] + n[1] * n[1] + n[2] * n[2]));
+                });
+        }
+
+        /*!
+         * \brief        Transforms `count` contiguous surface normals by `m`.
+         * \details      See the strided overload of `transform_normals()`.
+         *
+         * \tparam C     The column count of `m`. Must be 3 or 4.
+         * \tparam R     The row count of `m`. Must be 3 or 4.
+         *
+         * \param m      The transformation matrix.
+         * \param src    A pointer to the normals to transform.
+         * \param count  The number of normals to transform.
+         * \param dst    A pointer to where the transformed normals will be
+         *               stored. Can be the same as `src`.
+         */
+        template<int C, int R>
+        inline std::enable_if_t<(C >= 3 && R >= 3)> transform_normals(
+            const mat<float, C, R>& m,
+            const fvec3* src, std::size_t count, fvec3* dst) noexcept
+        {
+            tue::transform::transform_normals(
+                m, src, sizeof(fvec3), count, dst, sizeof(fvec3));
+        }
+
+        /*!
+         * \brief             Projects `count` points by `m`.
+         * \details           Each point `p` is transformed as `vec4(p, 1) *
+         *                    m` and then divided by the resulting `w`
+         *                    component.
+         *
+         * \param m           The projection matrix (e.g., as returned by
+         *                    `perspective_mat()` and composed with a view
+         *                    matrix).
+         * \param src         A pointer to the first point to project.
+         * \param src_stride  The distance (in bytes) between consecutive
+         *                    points in `src`.
+         * \param count       The number of points to project.
+         * \param dst         A pointer to where the first projected point
+         *                    will be stored.
+         * \param dst_stride  The distance (in bytes) between consecutive
+         *                    points in `dst`.
+         */
+        inline void project_points(
+            const fmat4x4& m,
+            const fvec3* src, std::size_t src_stride, std::size_t count,
+            fvec3* dst, std::size_t dst_stride) noexcept
+        {
+            using S = tue::detail_::transform_block_type;
+            const auto ms = mat<S, 4, 4>(m);
+            tue::detail_::transform_n(
+                src, src_stride, count, dst, dst_stride,
+                [&ms](const vec3<S>& v) noexcept
+                {
+                    const auto w = v[0] * ms[3][0] + v[1] * ms[3][1]
+                        + v[2] * ms[3][2] + ms[3][3];
+                    return tue::detail_::transform_block_points(ms, v)
+                        * (S(1.0f) / w);
+                });
+        }
+
+        /*!
+         * \brief        Projects `count` contiguous points by `m`.
+         * \details      See the strided overload of `project_points()`.
+         *
+         * \param m      The projection matrix.
+         * \param src    A pointer to the points to project.
+         * \param count  The number of points to project.
+         * \param dst    A pointer to where the projected points will be
+         *               stored. Can be the same as `src`.
+         */
+        inline void project_points(
+            const fmat4x4& m,
+            const fvec3* src, std::size_t count, fvec3* dst) noexcept
+        {
+            tue::transform::project_points(
+                m, src, sizeof(fvec3), count, dst, sizeof(fvec3));
+        }
+
         /*!@}*/
     }
 }
@@ -50,6 +50,11 @@ namespace tue
      *            - `tue::bool16`
      *            - `tue::bool32`
      *            - `tue::bool64`
+     *            - `tue::unorm8`
+     *            - `tue::unorm16`
+     *            - `tue::snorm8`
+     *            - `tue::snorm16`
+     *            - `tue::fixed`
      *            - `tue::simd`
      *
      * \tparam T  The type to check.
@@ -0,0 +1,173 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/bfloat16.hpp>
+#include "tue.tests.hpp"
+
+#include <cstdint>
+#include <limits>
+
+#include <tue/simd.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    bool is_nan_bits(std::uint16_t b)
+    {
+        return (b & 0x7F80u) == 0x7F80u && (b & 0x007Fu) != 0;
+    }
+
+    TEST_CASE(size)
+    {
+        test_assert(sizeof(bfloat16) == 2);
+        test_assert(alignof(bfloat16) == 2);
+    }
+
+    TEST_CASE(from_bits)
+    {
+        CONST_OR_CONSTEXPR auto b = bfloat16::from_bits(0x3F80u);
+        test_assert(b.bits() == 0x3F80u);
+        test_assert(float(b) == 1.0f);
+    }
+
+    TEST_CASE(float32_to_bfloat16)
+    {
+        test_assert(bfloat16(0.0f).bits() == 0x0000u);
+        test_assert(bfloat16(-0.0f).bits() == 0x8000u);
+        test_assert(bfloat16(1.0f).bits() == 0x3F80u);
+        test_assert(bfloat16(-2.0f).bits() == 0xC000u);
+        test_assert(bfloat16(std::numeric_limits<float>::infinity()).bits()
+            == 0x7F80u);
+        test_assert(bfloat16(std::numeric_limits<float>::max()).bits()
+            == 0x7F80u);
+        test_assert(is_nan_bits(
+            bfloat16(std::numeric_limits<float>::quiet_NaN()).bits()));
+
+        // A signaling NaN whose payload lives entirely in the low 16 bits
+        test_assert(is_nan_bits(
+            bfloat16(tue::detail_::bits_float(0x7F800001u)).bits()));
+    }
+
+    TEST_CASE(round_to_nearest_even)
+    {
+        test_assert(bfloat16(
+            tue::detail_::bits_float(0x3F808000u)).bits() == 0x3F80u);
+        test_assert(bfloat16(
+            tue::detail_::bits_float(0x3F818000u)).bits() == 0x3F82u);
+        test_assert(bfloat16(
+            tue::detail_::bits_float(0x3F808001u)).bits() == 0x3F81u);
+        test_assert(bfloat16(
+            tue::detail_::bits_float(0x3F807FFFu)).bits() == 0x3F80u);
+    }
+
+    TEST_CASE(load_bfloat16)
+    {
+        bfloat16 b[16];
+        for (int i = 0; i < 16; ++i)
+        {
+            b[i] = bfloat16(float(i) * 0.5f - 3.0f);
+        }
+
+        const auto s4 = load_bfloat16<4>(b + 1);
+        test_assert(s4 == float32x4(-2.5f, -2.0f, -1.5f, -1.0f));
+
+        const auto s8 = load_bfloat16<8>(b);
+        for (int i = 0; i < 8; ++i)
+        {
+            test_assert(s8.data()[i] == float(i) * 0.5f - 3.0f);
+        }
+
+        const auto s16 = load_bfloat16<16>(b);
+        for (int i = 0; i < 16; ++i)
+        {
+            test_assert(s16.data()[i] == float(i) * 0.5f - 3.0f);
+        }
+    }
+
+    TEST_CASE(store_bfloat16)
+    {
+        bfloat16 b[17];
+        b[16] = bfloat16::from_bits(0x1234u);
+
+        float32x16 s;
+        for (int i = 0; i < 16; ++i)
+        {
+            s.data()[i] = float(i) - 8.0f;
+        }
+
+        store_bfloat16(s, b);
+        for (int i = 0; i < 16; ++i)
+        {
+            test_assert(float(b[i]) == float(i) - 8.0f);
+        }
+
+        test_assert(b[16].bits() == 0x1234u);
+    }
+
+    template<int N>
+    void check_simd_matches_scalar()
+    {
+        for (std::uint32_t u = 0; u < 0xFFFFFFFFu - 0x00010000u;
+            u += 0x00010001u)
+        {
+            alignas(simd<float, N>) float f[N];
+            for (int i = 0; i < N; ++i)
+            {
+                f[i] = tue::detail_::bits_float(u + std::uint32_t(i) * 0x4000u);
+            }
+
+            bfloat16 b[N];
+            store_bfloat16(simd<float, N>::load(f), b);
+            for (int i = 0; i < N; ++i)
+            {
+                const auto expected = bfloat16(f[i]).bits();
+                if (is_nan_bits(expected))
+                {
+                    test_assert(is_nan_bits(b[i].bits()));
+                }
+#ifdef TUE_AVX512BF16
+                else if ((tue::detail_::float_bits(f[i]) & 0x7F800000u) == 0)
+                {
+                    test_assert((b[i].bits() & 0x7FFFu) == 0);
+                }
+#endif
+                else
+                {
+                    test_assert(b[i].bits() == expected);
+                }
+            }
+        }
+    }
+
+    TEST_CASE(simd_matches_scalar)
+    {
+        check_simd_matches_scalar<4>();
+        check_simd_matches_scalar<8>();
+        check_simd_matches_scalar<16>();
+    }
+
+    TEST_CASE(convert_n)
+    {
+        float f1[11];
+        for (int i = 0; i < 11; ++i)
+        {
+            f1[i] = float(i) * 0.25f - 1.0f;
+        }
+
+        bfloat16 b[11];
+        convert_n(f1, 11, b);
+
+        float f2[11];
+        convert_n(b, 11, f2);
+        for (int i = 0; i < 11; ++i)
+        {
+            test_assert(f2[i] == f1[i]);
+        }
+    }
+}
@@ -0,0 +1,196 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/dual_quat.hpp>
+#include "tue.tests.hpp"
+
+#include <tue/mat.hpp>
+#include <tue/math.hpp>
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    const auto q1 = transform::rotation_quat(dvec3(0.6, 0.0, 0.8), 1.1);
+    const auto q2 = transform::rotation_quat(dvec3(0.0, 1.0, 0.0), -2.3);
+    const dvec3 t1(1.2, -3.4, 5.6);
+    const dvec3 t2(-7.8, 9.1, 0.2);
+    const dvec3 p(0.3, 1.7, -2.9);
+
+    TEST_CASE(size)
+    {
+        test_assert(sizeof(fdual_quat) == sizeof(float[8]));
+        test_assert(sizeof(ddual_quat) == sizeof(double[8]));
+    }
+
+    TEST_CASE(identity)
+    {
+        CONST_OR_CONSTEXPR auto dq = ddual_quat::identity();
+        test_assert(dq.real() == dquat::identity());
+        test_assert(dq.dual() == dquat(0.0, 0.0, 0.0, 0.0));
+        test_assert(p * dq == p);
+    }
+
+    TEST_CASE(rigid_dual_quat)
+    {
+        const auto dq = transform::rigid_dual_quat(q1, t1);
+        test_assert(nearly_equal(p * dq, p * q1 + t1, 1e-12));
+        test_assert(transform::rotation_quat(dq) == q1);
+        test_assert(nearly_equal(
+            transform::translation_vec(dq), t1, 1e-12));
+    }
+
+    TEST_CASE(multiplication_operator)
+    {
+        const auto dq1 = transform::rigid_dual_quat(q1, t1);
+        const auto dq2 = transform::rigid_dual_quat(q2, t2);
+        test_assert(nearly_equal(p * (dq1 * dq2), p * dq1 * dq2, 1e-12));
+
+        auto dq3 = dq1;
+        test_assert(&(dq3 *= dq2) == &dq3);
+        test_assert(dq3 == dq1 * dq2);
+    }
+
+    TEST_CASE(equality_operator)
+    {
+        const auto dq1 = transform::rigid_dual_quat(q1, t1);
+        const auto dq2 = transform::rigid_dual_quat(q1, t2);
+        test_assert(dq1 == ddual_quat(dq1.real(), dq1.dual()));
+        test_assert(!(dq1 == dq2));
+        test_assert(dq1 != dq2);
+        test_assert(!(dq1 != dq1));
+    }
+
+    TEST_CASE(normalize)
+    {
+        const auto dq1 = transform::rigid_dual_quat(q1, t1);
+        const ddual_quat dq2(
+            dquat(dq1.real().xyzw() * 3.0), dquat(dq1.dual().xyzw() * 3.0));
+        const auto dq3 = math::normalize(dq2);
+        test_assert(nearly_equal(math::length(dq3.real().xyzw()), 1.0));
+        test_assert(nearly_equal(p * dq3, p * dq1, 1e-12));
+    }
+
+    TEST_CASE(rigid_mat)
+    {
+        const auto dq = transform::rigid_dual_quat(q1, t1);
+        const auto m34 = transform::rigid_mat<double, 3, 4>(dq);
+        const auto m43 = transform::rigid_mat<double, 4, 3>(dq);
+        const auto m44 = transform::rigid_mat(dq);
+        test_assert(nearly_equal(
+            transform::transform_point(m34, p), p * dq, 1e-12));
+        test_assert(nearly_equal(
+            transform::transform_point(m43, p), p * dq, 1e-12));
+        test_assert(nearly_equal(
+            transform::transform_point(m44, p), p * dq, 1e-12));
+
+        const ddual_quat dqs[] = {
+            transform::rigid_dual_quat(m34),
+            transform::rigid_dual_quat(m43),
+            transform::rigid_dual_quat(m44),
+        };
+
+        for (const auto& dq2 : dqs)
+        {
+            test_assert(nearly_equal(p * dq2, p * dq, 1e-12));
+        }
+
+        // Each component of the rotation gets a turn at being the largest
+        const dquat qs[] = {
+            math::normalize(dquat(0.9, 0.1, -0.2, 0.3)),
+            math::normalize(dquat(0.1, -0.9, 0.2, 0.3)),
+            math::normalize(dquat(-0.1, 0.2, 0.9, 0.3)),
+            math::normalize(dquat(0.1, 0.2, 0.3, -0.9)),
+        };
+
+        for (const auto& q : qs)
+        {
+            const auto dq2 = transform::rigid_dual_quat(q, t2);
+            const auto dq3 = transform::rigid_dual_quat(
+                transform::rigid_mat(dq2));
+            test_assert(nearly_equal(p * dq3, p * dq2, 1e-12));
+        }
+    }
+
+    TEST_CASE(blend)
+    {
+        const auto dq1 = transform::rigid_dual_quat(q1, t1);
+        const ddual_quat dq2(
+            dquat(-dq1.real().xyzw()), dquat(-dq1.dual().xyzw()));
+        const ddual_quat dqs1[] = { dq1, dq2 };
+        const double weights1[] = { 0.25, 0.75 };
+        const auto b1 = math::blend(dqs1, weights1, 2);
+        test_assert(nearly_equal(p * b1, p * dq1, 1e-12));
+
+        // Blending a rotation about one axis doesn't introduce scale
+        const auto dq3 = transform::rigid_dual_quat(
+            transform::rotation_quat(dvec3(0.0, 0.0, 1.0), 0.0), t1);
+        const auto dq4 = transform::rigid_dual_quat(
+            transform::rotation_quat(dvec3(0.0, 0.0, 1.0), 1.0), t1);
+        const ddual_quat dqs2[] = { dq3, dq4 };
+        const double weights2[] = { 0.5, 0.5 };
+        const auto b2 = math::blend(dqs2, weights2, 2);
+        const auto expected = transform::rigid_dual_quat(
+            transform::rotation_quat(dvec3(0.0, 0.0, 1.0), 0.5), t1);
+        test_assert(nearly_equal(p * b2, p * expected, 1e-12));
+    }
+
+    TEST_CASE(simd)
+    {
+        using S = simd<float, 8>;
+        const auto dq1 = fdual_quat(transform::rigid_dual_quat(q1, t1));
+        const auto dq2 = fdual_quat(transform::rigid_dual_quat(q2, t2));
+        const auto fp = fvec3(p);
+
+        quat<S> r1, d1, r2, d2;
+        S weights[2];
+        vec3<S> ps;
+        for (int i = 0; i < 8; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                r1[j].data()[i] = dq1.real()[j];
+                d1[j].data()[i] = dq1.dual()[j];
+                r2[j].data()[i] = dq2.real()[j];
+                d2[j].data()[i] = dq2.dual()[j];
+            }
+
+            for (int j = 0; j < 3; ++j)
+            {
+                ps[j].data()[i] = fp[j] * float(i + 1);
+            }
+
+            weights[0].data()[i] = float(i) / 7.0f;
+            weights[1].data()[i] = 1.0f - float(i) / 7.0f;
+        }
+
+        const dual_quat<S> dqs[] = {
+            dual_quat<S>(r1, d1),
+            dual_quat<S>(r2, d2),
+        };
+
+        const auto b = math::blend(dqs, weights, 2);
+        const auto rs = ps * b;
+        for (int i = 0; i < 8; ++i)
+        {
+            const fdual_quat fdqs[] = { dq1, dq2 };
+            const float fweights[] = {
+                weights[0].data()[i], weights[1].data()[i],
+            };
+
+            const auto expected = (fp * float(i + 1))
+                * math::blend(fdqs, fweights, 2);
+            const fvec3 r(rs[0].data()[i], rs[1].data()[i], rs[2].data()[i]);
+            test_assert(math::length(r - expected) < 1e-4f);
+        }
+    }
+}
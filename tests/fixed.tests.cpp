@@ -0,0 +1,291 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/fixed.hpp>
+#include "tue.tests.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include <tue/math.hpp>
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    // A small deterministic generator so the tests don't depend on <random>
+    std::uint32_t next_random(std::uint32_t& state)
+    {
+        state = state * 1664525u + 1013904223u;
+        return state;
+    }
+
+    TEST_CASE(fixed_types)
+    {
+        test_assert((std::is_same<
+            fixed16_16::storage_type, std::int32_t>::value));
+        test_assert((std::is_same<
+            fixed8_8::storage_type, std::int16_t>::value));
+        test_assert(sizeof(fixed16_16) == 4);
+        test_assert(sizeof(fixed8_8) == 2);
+        test_assert(is_vec_component<fixed16_16>::value);
+        test_assert((std::is_same<
+            simd<fixed16_16, 4>::bits_type, int32x4>::value));
+        test_assert((std::is_same<
+            simd<fixed8_8, 8>::bits_type, int16x8>::value));
+    }
+
+    TEST_CASE(fixed_conversions)
+    {
+        CONST_OR_CONSTEXPR fixed16_16 a(3);
+        CONST_OR_CONSTEXPR fixed16_16 b(-1.5f);
+        CONST_OR_CONSTEXPR fixed8_8 c(0.25);
+        test_assert(a.bits() == 3 << 16);
+        test_assert(b.bits() == -(3 << 15));
+        test_assert(c.bits() == 64);
+        test_assert(float(b) == -1.5f);
+        test_assert(double(c) == 0.25);
+        test_assert(int(a) == 3);
+        test_assert(int(b) == -2);
+        test_assert(fixed16_16::from_bits(1).bits() == 1);
+
+        // Rounds to nearest, ties away from zero
+        test_assert(fixed8_8(1.0f / 512.0f).bits() == 1);
+        test_assert(fixed8_8(-1.0f / 512.0f).bits() == -1);
+        test_assert(fixed8_8(1.0f / 1024.0f).bits() == 0);
+    }
+
+    TEST_CASE(fixed_arithmetic)
+    {
+        const fixed16_16 a(2.5f);
+        const fixed16_16 b(-1.25f);
+        test_assert(float(a + b) == 1.25f);
+        test_assert(float(a - b) == 3.75f);
+        test_assert(float(a * b) == -3.125f);
+        test_assert(float(a / b) == -2.0f);
+        test_assert(float(-a) == -2.5f);
+        test_assert(+a == a);
+
+        // Multiplication rounds toward negative infinity and division
+        // toward zero
+        const auto tiny = fixed16_16::from_bits(1);
+        test_assert((tiny * fixed16_16(0.5f)).bits() == 0);
+        test_assert((-tiny * fixed16_16(0.5f)).bits() == -1);
+        test_assert((fixed16_16(1) / fixed16_16(3)).bits() == 21845);
+        test_assert((fixed16_16(-1) / fixed16_16(3)).bits() == -21845);
+
+        auto c = a;
+        c += b;
+        test_assert(c == fixed16_16(1.25f));
+        c -= b;
+        test_assert(c == a);
+        c *= b;
+        test_assert(c == a * b);
+        c /= b;
+        test_assert(c == a);
+
+        test_assert(b < a);
+        test_assert(b <= a);
+        test_assert(a > b);
+        test_assert(a >= a);
+        test_assert(a != b);
+
+        const fixed8_8 d(1.5f);
+        const fixed8_8 e(-0.75f);
+        test_assert(float(d * e) == -1.125f);
+        test_assert(float(d / e) == -2.0f);
+    }
+
+    TEST_CASE(fixed_math)
+    {
+        const fixed16_16 a(2.5f);
+        const fixed16_16 b(-1.25f);
+        test_assert(math::abs(b) == fixed16_16(1.25f));
+        test_assert(math::min(a, b) == b);
+        test_assert(math::max(a, b) == a);
+        test_assert(math::sqrt(fixed16_16(4)) == fixed16_16(2));
+        test_assert(math::sqrt(fixed8_8(0.25f)) == fixed8_8(0.5f));
+        test_assert(math::sqrt(b) == fixed16_16(0));
+
+        // sqrt() is the exact result rounded down
+        for (std::int32_t bits = 1; bits < (1 << 30); bits = bits * 3 + 7)
+        {
+            const auto r = math::sqrt(fixed16_16::from_bits(bits)).bits();
+            const auto x = std::int64_t(bits) << 16;
+            test_assert(std::int64_t(r) * r <= x);
+            test_assert(std::int64_t(r + 1) * (r + 1) > x);
+        }
+
+        test_assert(math::less(b, a) == true32);
+        test_assert(math::less_equal(a, a) == true32);
+        test_assert(math::greater_equal(b, a) == false32);
+        test_assert(math::equal(a, a) == true32);
+        test_assert(math::not_equal(a, a) == false32);
+        test_assert(math::less(fixed8_8(1), fixed8_8(2)) == true16);
+        test_assert(math::greater(b, a) == false32);
+        test_assert(math::select(true32, a, b) == a);
+    }
+
+    TEST_CASE(fixed_sincos)
+    {
+        for (int i = -400; i <= 400; ++i)
+        {
+            const auto x = float(i) * 0.0271f;
+            const fixed16_16 fx(x);
+            const auto expected_x = double(fx);
+
+            fixed16_16 s, c;
+            math::sincos(fx, s, c);
+            test_assert(std::abs(double(s) - std::sin(expected_x)) < 0.0002);
+            test_assert(std::abs(double(c) - std::cos(expected_x)) < 0.0002);
+            test_assert(math::sin(fx) == s);
+            test_assert(math::cos(fx) == c);
+
+            const fixed8_8 hx(x * 0.25f);
+            const auto expected_hx = double(hx);
+            test_assert(std::abs(
+                double(math::sin(hx)) - std::sin(expected_hx)) < 0.012);
+            test_assert(std::abs(
+                double(math::cos(hx)) - std::cos(expected_hx)) < 0.012);
+        }
+
+        test_assert(math::sin(fixed16_16(0)) == fixed16_16(0));
+        test_assert(math::cos(fixed16_16(0)) == fixed16_16(1));
+    }
+
+    template<typename F, int N>
+    void check_simd_matches_scalar(std::uint32_t seed)
+    {
+        using S = typename F::storage_type;
+        using V = simd<F, N>;
+        for (int iteration = 0; iteration < 64; ++iteration)
+        {
+            alignas(V) F x[N];
+            alignas(V) F y[N];
+            for (int i = 0; i < N; ++i)
+            {
+                // Keep the operands small enough that the products and
+                // quotients are in range.
+                const auto shift = 8 * int(sizeof(S)) / 2 + 2;
+                x[i] = F::from_bits(
+                    S(std::int32_t(next_random(seed)) >> shift));
+                y[i] = F::from_bits(
+                    S(std::int32_t(next_random(seed)) >> shift));
+                if (y[i].bits() == 0)
+                {
+                    y[i] = F(1);
+                }
+            }
+
+            const auto a = V::load(x);
+            const auto b = V::load(y);
+            alignas(V) F product[N];
+            alignas(V) F quotient[N];
+            alignas(V) F sum[N];
+            alignas(V) F difference[N];
+            alignas(V) F negation[N];
+            alignas(V) F abs[N];
+            alignas(V) F sqrt[N];
+            alignas(V) F sin[N];
+            alignas(V) F cos[N];
+            (a * b).store(product);
+            (a / b).store(quotient);
+            (a + b).store(sum);
+            (a - b).store(difference);
+            (-a).store(negation);
+            math::abs(a).store(abs);
+            math::sqrt(math::abs(a)).store(sqrt);
+            V vsin, vcos;
+            math::sincos(a, vsin, vcos);
+            vsin.store(sin);
+            vcos.store(cos);
+
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(product[i] == x[i] * y[i]);
+                test_assert(quotient[i] == x[i] / y[i]);
+                test_assert(sum[i] == x[i] + y[i]);
+                test_assert(difference[i] == x[i] - y[i]);
+                test_assert(negation[i] == -x[i]);
+                test_assert(abs[i] == math::abs(x[i]));
+                test_assert(sqrt[i] == math::sqrt(math::abs(x[i])));
+                test_assert(sin[i] == math::sin(x[i]));
+                test_assert(cos[i] == math::cos(x[i]));
+            }
+        }
+    }
+
+    TEST_CASE(fixed_simd_matches_scalar)
+    {
+        check_simd_matches_scalar<fixed16_16, 4>(2u);
+        check_simd_matches_scalar<fixed16_16, 8>(3u);
+        check_simd_matches_scalar<fixed16_16, 16>(4u);
+        check_simd_matches_scalar<fixed<8, 24>, 4>(5u);
+        check_simd_matches_scalar<fixed8_8, 4>(6u);
+        check_simd_matches_scalar<fixed8_8, 8>(7u);
+        check_simd_matches_scalar<fixed8_8, 16>(8u);
+        check_simd_matches_scalar<fixed<4, 12>, 8>(9u);
+    }
+
+    TEST_CASE(fixed_simd)
+    {
+        using fixed16_16x4 = simd<fixed16_16, 4>;
+        const fixed16_16x4 a(
+            fixed16_16(1), fixed16_16(-2), fixed16_16(0.5f), fixed16_16(3));
+        const fixed16_16x4 b(fixed16_16(2));
+
+        const auto product = a * b;
+        test_assert(product.bits() == int32x4(
+            2 << 16, -(4 << 16), 1 << 16, 6 << 16));
+        test_assert(a / b * b == a);
+        test_assert(math::min(a, b).data()[3] == fixed16_16(2));
+        test_assert(math::max(a, b).data()[1] == fixed16_16(2));
+        test_assert(math::select(
+            math::less(a.bits(), b.bits()), a, b).data()[3] == fixed16_16(2));
+        test_assert(fixed16_16x4::zero().bits() == int32x4::zero());
+
+        alignas(fixed16_16x4) fixed16_16 data[4];
+        a.store(data);
+        test_assert(fixed16_16x4::load(data) == a);
+        test_assert(data[1] == fixed16_16(-2));
+
+        auto c = a;
+        c *= b;
+        c -= a;
+        test_assert(c == a);
+        c += a;
+        c /= b;
+        test_assert(c == a);
+        test_assert(c != b);
+    }
+
+    TEST_CASE(fixed_vec_and_quat)
+    {
+        const vec3<fixed16_16> v(
+            fixed16_16(1), fixed16_16(2), fixed16_16(-0.5f));
+        const auto w = v * fixed16_16(2) + v;
+        test_assert(w == vec3<fixed16_16>(
+            fixed16_16(3), fixed16_16(6), fixed16_16(-1.5f)));
+        test_assert(math::dot(v, v) == fixed16_16(5.25f));
+
+        const quat<fixed16_16> q(
+            fixed16_16(0), fixed16_16(0), fixed16_16(0), fixed16_16(1));
+        test_assert(q * q == q);
+
+        const vec3<simd<fixed16_16, 4>> sv(
+            simd<fixed16_16, 4>(fixed16_16(1)),
+            simd<fixed16_16, 4>(fixed16_16(2)),
+            simd<fixed16_16, 4>(fixed16_16(-0.5f)));
+        const auto sd = math::dot(sv, sv);
+        test_assert(sd.data()[2] == fixed16_16(5.25f));
+    }
+}
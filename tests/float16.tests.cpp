@@ -0,0 +1,186 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/float16.hpp>
+#include "tue.tests.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <tue/simd.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    bool is_nan_bits(std::uint16_t h)
+    {
+        return (h & 0x7C00u) == 0x7C00u && (h & 0x03FFu) != 0;
+    }
+
+    TEST_CASE(size)
+    {
+        test_assert(sizeof(float16) == 2);
+        test_assert(alignof(float16) == 2);
+    }
+
+    TEST_CASE(from_bits)
+    {
+        CONST_OR_CONSTEXPR auto h = float16::from_bits(0x3C00u);
+        test_assert(h.bits() == 0x3C00u);
+        test_assert(float(h) == 1.0f);
+    }
+
+    TEST_CASE(float32_to_float16)
+    {
+        test_assert(float16(0.0f).bits() == 0x0000u);
+        test_assert(float16(-0.0f).bits() == 0x8000u);
+        test_assert(float16(1.0f).bits() == 0x3C00u);
+        test_assert(float16(-2.0f).bits() == 0xC000u);
+        test_assert(float16(65504.0f).bits() == 0x7BFFu);
+        test_assert(float16(65520.0f).bits() == 0x7C00u);
+        test_assert(float16(1.0e10f).bits() == 0x7C00u);
+        test_assert(float16(-1.0e10f).bits() == 0xFC00u);
+        test_assert(float16(std::ldexp(1.0f, -24)).bits() == 0x0001u);
+        test_assert(float16(std::ldexp(1.0f, -26)).bits() == 0x0000u);
+        test_assert(float16(std::numeric_limits<float>::infinity()).bits()
+            == 0x7C00u);
+        test_assert(is_nan_bits(
+            float16(std::numeric_limits<float>::quiet_NaN()).bits()));
+    }
+
+    TEST_CASE(round_to_nearest_even)
+    {
+        // 1 + 2^-11 is exactly halfway between 1 and the next half
+        test_assert(float16(1.0f + std::ldexp(1.0f, -11)).bits() == 0x3C00u);
+        test_assert(float16(1.0f + 3 * std::ldexp(1.0f, -11)).bits()
+            == 0x3C02u);
+        test_assert(float16(1.0f + std::ldexp(1.0f, -11)
+            + std::ldexp(1.0f, -20)).bits() == 0x3C01u);
+    }
+
+    TEST_CASE(float16_round_trip)
+    {
+        for (std::uint32_t i = 0; i < 0x10000u; ++i)
+        {
+            const auto h = float16::from_bits(std::uint16_t(i));
+            const auto f = float(h);
+            if (is_nan_bits(h.bits()))
+            {
+                test_assert(f != f);
+            }
+            else
+            {
+                test_assert(float16(f).bits() == h.bits());
+            }
+        }
+    }
+
+    TEST_CASE(load_float16)
+    {
+        float16 h[16];
+        for (int i = 0; i < 16; ++i)
+        {
+            h[i] = float16(float(i) * 0.5f - 3.0f);
+        }
+
+        const auto s4 = load_float16<4>(h + 1);
+        test_assert(s4 == float32x4(-2.5f, -2.0f, -1.5f, -1.0f));
+
+        const auto s8 = load_float16<8>(h);
+        for (int i = 0; i < 8; ++i)
+        {
+            test_assert(s8.data()[i] == float(i) * 0.5f - 3.0f);
+        }
+
+        const auto s2 = load_float16<2>(h + 6);
+        test_assert(s2 == float32x2(0.0f, 0.5f));
+
+        const auto s16 = load_float16<16>(h);
+        test_assert(s16.data()[15] == 4.5f);
+    }
+
+    TEST_CASE(store_float16)
+    {
+        float16 h[9];
+        h[8] = float16::from_bits(0x1234u);
+        store_float16(
+            float32x8(1.0f, -1.0f, 0.5f, 65504.0f,
+                1.0e10f, -0.0f, std::ldexp(1.0f, -24), 3.0f),
+            h);
+
+        test_assert(h[0].bits() == 0x3C00u);
+        test_assert(h[1].bits() == 0xBC00u);
+        test_assert(h[2].bits() == 0x3800u);
+        test_assert(h[3].bits() == 0x7BFFu);
+        test_assert(h[4].bits() == 0x7C00u);
+        test_assert(h[5].bits() == 0x8000u);
+        test_assert(h[6].bits() == 0x0001u);
+        test_assert(h[7].bits() == 0x4200u);
+        test_assert(h[8].bits() == 0x1234u);
+    }
+
+    TEST_CASE(simd_matches_scalar)
+    {
+        // Sweep float bit patterns across the whole range, including
+        // subnormal, overflow, and halfway cases.
+        for (std::uint32_t u = 0; u < 0xFFFFFFFFu - 0x00010000u;
+            u += 0x00010001u)
+        {
+            float f[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                f[i] = tue::detail_::bits_float(u + std::uint32_t(i) * 0x1000u);
+            }
+
+            float16 h[4];
+            store_float16(float32x4::loadu(f), h);
+            for (int i = 0; i < 4; ++i)
+            {
+                const auto expected = float16(f[i]).bits();
+                if (is_nan_bits(expected))
+                {
+                    test_assert(is_nan_bits(h[i].bits()));
+                }
+                else
+                {
+                    test_assert(h[i].bits() == expected);
+                }
+            }
+
+            const auto back = load_float16<4>(h);
+            for (int i = 0; i < 4; ++i)
+            {
+                const auto expected = float(h[i]);
+                const auto actual = back.data()[i];
+                test_assert(actual == expected
+                    || (actual != actual && expected != expected));
+            }
+        }
+    }
+
+    TEST_CASE(convert_n)
+    {
+        float f1[11];
+        for (int i = 0; i < 11; ++i)
+        {
+            f1[i] = float(i) * 0.25f - 1.0f;
+        }
+
+        float16 h[11];
+        convert_n(f1, 11, h);
+
+        float f2[11];
+        convert_n(h, 11, f2);
+        for (int i = 0; i < 11; ++i)
+        {
+            test_assert(f2[i] == f1[i]);
+        }
+    }
+}
@@ -0,0 +1,163 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/frustum.hpp>
+#include "tue.tests.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <tue/mat.hpp>
+#include <tue/math.hpp>
+#include <tue/simd.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    template<int N>
+    vec3<simd<float, N>> pack_vec3s(const fvec3* vs)
+    {
+        vec3<simd<float, N>> result;
+        for (int i = 0; i < N; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                result[j].data()[i] = vs[i][j];
+            }
+        }
+
+        return result;
+    }
+
+    // A 90 degree field of view looking down -z from (0, 0, 5), so the
+    // frustum's sides are at |x| = |y| = 5 - z
+    const auto view_projection =
+        transform::translation_mat(0.0f, 0.0f, -5.0f)
+        * transform::perspective_mat(1.57079632679f, 1.0f, 1.0f, 100.0f);
+
+    TEST_CASE(planes)
+    {
+        const frustum<float> f(view_projection);
+        for (int i = 0; i < frustum<float>::plane_count; ++i)
+        {
+            test_assert(nearly_equal(math::length(f.plane(i).xyz()), 1.0f));
+
+            // Just in front of the camera is inside every plane but the
+            // near one
+            const auto d = math::dot(fvec4(0.0f, 0.0f, 4.9f, 1.0f),
+                f.plane(i));
+            test_assert(i == 4 ? d < 0.0f : d > 0.0f);
+        }
+    }
+
+    TEST_CASE(cull_spheres)
+    {
+        const frustum<float> f(view_projection);
+        const fvec3 centers[] = {
+            { 0.0f, 0.0f, -5.0f },
+            { 0.0f, 0.0f, 10.0f },
+            { 0.0f, 0.0f, -200.0f },
+            { 0.0f, 0.0f, -200.0f },
+            { 20.0f, 0.0f, -5.0f },
+            { 10.5f, 0.0f, -5.0f },
+            { 0.0f, -12.0f, -5.0f },
+            { 0.0f, 0.0f, 4.5f },
+        };
+        const float radii[] = {
+            1.0f, 1.0f, 1.0f, 150.0f, 1.0f, 1.0f, 1.0f, 0.1f,
+        };
+
+        simd<float, 8> r;
+        for (int i = 0; i < 8; ++i)
+        {
+            r.data()[i] = radii[i];
+        }
+
+        const vec3<simd<float, 8>> blocks[] = {
+            pack_vec3s<8>(centers),
+            pack_vec3s<8>(centers),
+        };
+        const simd<float, 8> rs[] = { r, r };
+        std::uint8_t visible[2];
+        culling::cull_spheres(f, blocks, rs, 2, visible);
+        test_assert(visible[0] == 0x29);
+        test_assert(visible[1] == 0x29);
+
+        // 4-wide blocks
+        const vec3<simd<float, 4>> blocks4[] = {
+            pack_vec3s<4>(centers),
+            pack_vec3s<4>(centers + 4),
+        };
+        simd<float, 4> rs4[2];
+        for (int i = 0; i < 8; ++i)
+        {
+            rs4[i/4].data()[i%4] = radii[i];
+        }
+
+        std::uint8_t visible4[2];
+        culling::cull_spheres(f, blocks4, rs4, 2, visible4);
+        test_assert(visible4[0] == 0x9);
+        test_assert(visible4[1] == 0x2);
+    }
+
+    TEST_CASE(cull_aabbs)
+    {
+        const frustum<float> f(view_projection);
+        const fvec3 centers[] = {
+            { 0.0f, 0.0f, -5.0f },
+            { 0.0f, 0.0f, 10.0f },
+            { 13.0f, 0.0f, -5.0f },
+            { 13.0f, 0.0f, -5.0f },
+            { 0.0f, 0.0f, -110.0f },
+            { 0.0f, 0.0f, -110.0f },
+            { 0.0f, 17.5f, -10.0f },
+            { 0.0f, 17.5f, -10.0f },
+        };
+        const fvec3 extents[] = {
+            { 1.0f, 1.0f, 1.0f },
+            { 1.0f, 1.0f, 1.0f },
+            { 1.0f, 1.0f, 1.0f },
+            { 2.5f, 1.0f, 1.0f },
+            { 1.0f, 1.0f, 1.0f },
+            { 1.0f, 1.0f, 20.0f },
+            { 1.0f, 1.0f, 1.0f },
+            { 1.0f, 3.0f, 0.1f },
+        };
+
+        const auto c = pack_vec3s<8>(centers);
+        const auto e = pack_vec3s<8>(extents);
+        std::uint8_t visible;
+        culling::cull_aabbs(f, &c, &e, 1, &visible);
+        test_assert(visible == 0xA9);
+    }
+
+    TEST_CASE(ortho)
+    {
+        const frustum<float> f(
+            transform::ortho_mat(20.0f, 20.0f, 1.0f, 100.0f));
+        const fvec3 centers[] = {
+            { 9.0f, 0.0f, -50.0f },
+            { 11.0f, 0.0f, -50.0f },
+            { 11.0f, 0.0f, -50.0f },
+            { 0.0f, 0.0f, 0.0f },
+        };
+        simd<float, 4> r;
+        r.data()[0] = 0.5f;
+        r.data()[1] = 0.5f;
+        r.data()[2] = 1.5f;
+        r.data()[3] = 0.5f;
+
+        const auto c = pack_vec3s<4>(centers);
+        std::uint8_t visible;
+        culling::cull_spheres(f, &c, &r, 1, &visible);
+        test_assert(visible == 0x5);
+    }
+}
@@ -0,0 +1,176 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/hierarchy.hpp>
+#include "tue.tests.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <tue/mat.hpp>
+#include <tue/math.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    constexpr std::size_t node_count = 100;
+
+    // Two roots (0 and 7) with children listed before their parents and
+    // levels of uneven sizes
+    std::vector<int> test_parents()
+    {
+        std::vector<int> parents(node_count);
+        for (std::size_t i = 0; i < node_count; ++i)
+        {
+            parents[i] = int(i * 3 / 5);
+        }
+
+        parents[0] = -1;
+        parents[7] = -1;
+        parents[3] = 99;
+        return parents;
+    }
+
+    fmat4x3 test_local(std::size_t i)
+    {
+        const auto f = float(i);
+        auto m = transform::rotation_mat<float, 4, 3>(
+            math::normalize(fvec3(std::sin(f), 1.0f, std::cos(f))),
+            0.3f * f);
+        m[3] = fvec3(std::cos(f * 1.7f), 0.5f, std::sin(f * 0.9f));
+        return m;
+    }
+
+    std::vector<fmat4x3> expected_worlds(
+        const std::vector<int>& parents, const hierarchy& h)
+    {
+        std::vector<fmat4x3> worlds(node_count);
+        std::vector<bool> done(node_count, false);
+        for (std::size_t pass = 0; pass < node_count; ++pass)
+        {
+            for (std::size_t i = 0; i < node_count; ++i)
+            {
+                if (parents[i] < 0)
+                {
+                    worlds[i] = h.local(i);
+                    done[i] = true;
+                }
+                else if (done[std::size_t(parents[i])])
+                {
+                    worlds[i] = math::affine_mult(
+                        worlds[std::size_t(parents[i])], h.local(i));
+                    done[i] = true;
+                }
+            }
+        }
+
+        return worlds;
+    }
+
+    TEST_CASE(breadth_first_order)
+    {
+        const auto parents = test_parents();
+        const hierarchy h(parents.data(), node_count);
+        test_assert(h.size() == node_count);
+        test_assert(h.level_begin(0) == 0);
+        test_assert(h.level_end(0) == 2);
+        test_assert(h.level_end(h.level_count() - 1) == node_count);
+
+        for (int level = 0; level < h.level_count(); ++level)
+        {
+            test_assert(h.level_begin(level) < h.level_end(level));
+            for (auto pos = h.level_begin(level);
+                pos < h.level_end(level); ++pos)
+            {
+                test_assert(h.position(h.node(pos)) == pos);
+                if (level == 0)
+                {
+                    test_assert(h.parent(pos) == -1);
+                }
+                else
+                {
+                    const auto parent = std::size_t(h.parent(pos));
+                    test_assert(parent >= h.level_begin(level - 1));
+                    test_assert(parent < h.level_end(level - 1));
+                    test_assert(int(h.node(parent))
+                        == parents[h.node(pos)]);
+                }
+            }
+        }
+    }
+
+    TEST_CASE(update)
+    {
+        const auto parents = test_parents();
+        hierarchy h(parents.data(), node_count);
+        test_assert(h.world(42) == fmat4x3::identity());
+
+        for (std::size_t i = 0; i < node_count; ++i)
+        {
+            h.set_local(i, test_local(i));
+        }
+
+        h.update();
+        auto expected = expected_worlds(parents, h);
+        for (std::size_t i = 0; i < node_count; ++i)
+        {
+            test_assert(nearly_equal(h.world(i), expected[i], 1e-4f));
+        }
+
+        // Only node 4's subtree changes
+        const auto world7 = h.world(7);
+        const auto world10 = h.world(10);
+        auto local4 = fmat4x3::identity();
+        local4[3] = fvec3(1.0f, 2.0f, 3.0f);
+        h.set_local(4, local4);
+        h.update();
+        expected = expected_worlds(parents, h);
+        for (std::size_t i = 0; i < node_count; ++i)
+        {
+            test_assert(nearly_equal(h.world(i), expected[i], 1e-4f));
+        }
+
+        test_assert(h.world(7) == world7);
+        test_assert(h.world(10) == world10);
+        test_assert(!(h.world(4) == test_local(4)));
+    }
+
+    TEST_CASE(update_range)
+    {
+        const auto parents = test_parents();
+        hierarchy h1(parents.data(), node_count);
+        hierarchy h2(parents.data(), node_count);
+        for (std::size_t i = 0; i < node_count; ++i)
+        {
+            h1.set_local(i, test_local(i));
+            h2.set_local(i, test_local(i));
+        }
+
+        h1.update();
+
+        // Split each level into uneven ranges, as if across threads
+        for (int level = 0; level < h2.level_count(); ++level)
+        {
+            const auto begin = h2.level_begin(level);
+            const auto end = h2.level_end(level);
+            const auto mid = begin + (end - begin) / 3;
+            h2.update_range(mid, end);
+            h2.update_range(begin, mid);
+        }
+
+        h2.clear_dirty();
+        for (std::size_t i = 0; i < node_count; ++i)
+        {
+            test_assert(h2.world(i) == h1.world(i));
+        }
+    }
+}
@@ -0,0 +1,92 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/lazy.hpp>
+#include "tue.tests.hpp"
+
+#include <type_traits>
+
+#include <tue/mat.hpp>
+#include <tue/math.hpp>
+#include <tue/simd.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    TEST_CASE(lazy_vec)
+    {
+        const fvec3 a(1.0f, 2.0f, 3.0f);
+        const fvec3 b(-4.0f, 0.5f, 2.0f);
+        const fvec3 c(0.25f, -1.0f, 8.0f);
+        const auto s = 2.0f;
+        const auto t = -3.0f;
+
+        const fvec3 r1 = lazy(a) * s + lazy(b) * t - c;
+        test_assert(r1 == a * s + b * t - c);
+        test_assert(fvec3(lazy(a) * s + b * t - c) == r1);
+
+        const fvec3 r2 = -(lazy(a) / s) + 1.0f - lazy(b) * c;
+        test_assert(r2 == -(a / s) + 1.0f - b * c);
+
+        const auto r3 = (s * lazy(a) - t / lazy(c)).eval();
+        test_assert((std::is_same<decltype(r3), const fvec3>::value));
+        test_assert(r3 == s * a - t / c);
+
+        test_assert(fvec3(+lazy(a)) == a);
+
+        // Conversions work like the vec converting constructor
+        const dvec3 r4 = lazy(a) + b;
+        test_assert(r4 == dvec3(a + b));
+    }
+
+    TEST_CASE(lazy_vec_simd)
+    {
+        const vec3<float32x8> a(
+            float32x8(1.0f), float32x8(2.0f), float32x8(3.0f));
+        const vec3<float32x8> b(
+            float32x8(-4.0f), float32x8(0.5f), float32x8(2.0f));
+        const vec3<float32x8> c(
+            float32x8(0.25f), float32x8(-1.0f), float32x8(8.0f));
+        const float32x8 s(2.0f, 1.0f, 0.5f, 0.0f, -0.5f, -1.0f, -2.0f, 4.0f);
+        const float32x8 t(-3.0f);
+
+        const vec3<float32x8> r = lazy(a) * s + lazy(b) * t - c;
+        test_assert(r == a * s + b * t - c);
+    }
+
+    TEST_CASE(lazy_mat)
+    {
+        const auto p = transform::perspective_mat(1.2f, 1.5f, 0.1f, 100.0f);
+        const auto v = transform::rotation_mat(0.0f, 1.0f, 0.0f, 0.7f)
+            * transform::translation_mat(1.0f, -2.0f, 3.0f);
+        const auto m = transform::scale_mat(2.0f, 0.5f, 3.0f);
+        const fvec4 x(1.0f, 2.0f, 3.0f, 1.0f);
+
+        // Column vectors are multiplied from the right
+        const fvec4 y1 = lazy(p) * v * m * x;
+        test_assert(y1 == p * (v * (m * x)));
+
+        // Row vectors are multiplied from the left
+        const fvec4 y2 = x * (lazy(m) * v * p);
+        test_assert(y2 == ((x * m) * v) * p);
+
+        // Products without a vector are multiplied left to right
+        const fmat4x4 pvm = lazy(p) * v * m;
+        test_assert(pvm == (p * v) * m);
+        test_assert((lazy(p) * lazy(v)).eval() == p * v);
+
+        // Matrix-vector products continue as lazy vector expressions
+        const fvec4 y3 = lazy(m) * x + x * 2.0f;
+        test_assert(y3 == m * x + x * 2.0f);
+        const fvec4 y4 = lazy(m) * (lazy(x) + x);
+        test_assert(y4 == m * (x + x));
+    }
+}
@@ -11,6 +11,7 @@
 
 #include <type_traits>
 #include <tue/math.hpp>
+#include <tue/simd.hpp>
 #include <tue/sized_bool.hpp>
 #include <tue/unused.hpp>
 #include <tue/vec.hpp>
@@ -1026,4 +1027,74 @@ namespace
         test_assert(m3[2] == dm24.row(2));
         test_assert(m3[3] == dm24.row(3));
     }
+
+    TEST_CASE(determinant)
+    {
+        CONST_OR_CONSTEXPR dmat2x2 m = {
+            { 4.0, 7.0 },
+            { 2.0, 6.0 },
+        };
+
+        CONST_OR_CONSTEXPR auto d = math::determinant(m);
+        test_assert(d == 10.0);
+        test_assert(math::determinant(fmat2x2(m)) == 10.0f);
+    }
+
+    TEST_CASE(inverse)
+    {
+        CONST_OR_CONSTEXPR dmat2x2 m = {
+            { 4.0, 7.0 },
+            { 2.0, 6.0 },
+        };
+
+        CONST_OR_CONSTEXPR auto i = math::inverse(m);
+        test_assert(nearly_equal(i[0][0], 0.6));
+        test_assert(nearly_equal(i[0][1], -0.7));
+        test_assert(nearly_equal(i[1][0], -0.2));
+        test_assert(nearly_equal(i[1][1], 0.4));
+
+        const mat2x2<float32x4> sm = {
+            { float32x4(4.0f, 1.0f, 2.0f, -3.0f), float32x4(7.0f) },
+            { float32x4(2.0f), float32x4(6.0f, 5.0f, 1.0f, 2.0f) },
+        };
+
+        const auto si = math::inverse(sm);
+        for (int k = 0; k < 4; ++k)
+        {
+            const fmat2x2 fm = {
+                { sm[0][0].data()[k], sm[0][1].data()[k] },
+                { sm[1][0].data()[k], sm[1][1].data()[k] },
+            };
+
+            const auto fi = math::inverse(fm);
+            test_assert(si[0][0].data()[k] == fi[0][0]);
+            test_assert(si[0][1].data()[k] == fi[0][1]);
+            test_assert(si[1][0].data()[k] == fi[1][0]);
+            test_assert(si[1][1].data()[k] == fi[1][1]);
+        }
+    }
+
+    TEST_CASE(solve)
+    {
+        CONST_OR_CONSTEXPR dmat2x2 spd = { { 4.0, 2.0 }, { 2.0, 3.0 } };
+        CONST_OR_CONSTEXPR dmat2x2 m = { { 2.0, 1.0 }, { -1.0, 3.0 } };
+        const dvec2 b(1.0, -2.0);
+
+        const auto x1 = math::solve_cholesky(spd, b);
+        const auto x2 = math::solve_ldlt(spd, b);
+        const auto x3 = math::solve_lu(m, b);
+        test_assert(math::length(spd * x1 - b) < 1e-12);
+        test_assert(math::length(spd * x2 - b) < 1e-12);
+        test_assert(math::length(m * x3 - b) < 1e-12);
+
+        const auto sm = mat2x2<float32x4>(fmat2x2(m));
+        const vec2<float32x4> sb(float32x4(1.0f, 2.0f, 3.0f, 4.0f));
+        const auto sx = math::solve_lu(sm, sb);
+        for (int k = 0; k < 4; ++k)
+        {
+            const auto bk = fvec2(float(k + 1));
+            const auto xk = fvec2(sx[0].data()[k], sx[1].data()[k]);
+            test_assert(math::length(fmat2x2(m) * xk - bk) < 1e-5f);
+        }
+    }
 }
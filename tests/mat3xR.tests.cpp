@@ -9,8 +9,14 @@
 #include <tue/mat.hpp>
 #include "tue.tests.hpp"
 
+#include <cmath>
+#include <cstddef>
+#include <iterator>
 #include <type_traits>
+#include <vector>
+
 #include <tue/math.hpp>
+#include <tue/simd.hpp>
 #include <tue/sized_bool.hpp>
 #include <tue/unused.hpp>
 #include <tue/vec.hpp>
@@ -1163,4 +1169,380 @@ namespace
         test_assert(m3[2] == dm34.row(2));
         test_assert(m3[3] == dm34.row(3));
     }
+
+    TEST_CASE(determinant)
+    {
+        CONST_OR_CONSTEXPR dmat3x3 m = {
+            { 2.0, 1.0, 0.0 },
+            { 1.0, 3.0, 1.0 },
+            { 0.0, 1.0, 4.0 },
+        };
+
+        CONST_OR_CONSTEXPR auto d = math::determinant(m);
+        test_assert(nearly_equal(d, 18.0));
+        test_assert(nearly_equal(math::determinant(math::transpose(m)), 18.0));
+    }
+
+    TEST_CASE(inverse)
+    {
+        CONST_OR_CONSTEXPR dmat3x3 m = {
+            { 2.0, 1.0, 0.0 },
+            { 1.0, 3.0, -1.0 },
+            { 0.5, 1.0, 4.0 },
+        };
+
+        CONST_OR_CONSTEXPR auto i = math::inverse(m);
+        const auto p1 = m * i;
+        const auto p2 = i * m;
+        for (int c = 0; c < 3; ++c)
+        {
+            for (int r = 0; r < 3; ++r)
+            {
+                const auto expected = c == r ? 1.0 : 0.0;
+                test_assert(math::abs(p1[c][r] - expected) < 1e-12);
+                test_assert(math::abs(p2[c][r] - expected) < 1e-12);
+            }
+        }
+    }
+
+    TEST_CASE(inverse_rigid)
+    {
+        CONST_OR_CONSTEXPR dmat3x4 m = {
+            { 0.6, 0.0, -0.8, 2.0 },
+            { 0.0, 1.0, 0.0, -3.0 },
+            { 0.8, 0.0, 0.6, 5.0 },
+        };
+
+        CONST_OR_CONSTEXPR auto i = math::inverse_rigid(m);
+        const dvec3 p(1.0, 2.0, 3.0);
+        const auto q = dvec4(p, 1.0) * m;
+        const auto r = dvec4(q, 1.0) * i;
+        test_assert(math::abs(r[0] - p[0]) < 1e-12);
+        test_assert(math::abs(r[1] - p[1]) < 1e-12);
+        test_assert(math::abs(r[2] - p[2]) < 1e-12);
+    }
+
+    TEST_CASE(inverse_affine)
+    {
+        const fmat3x4 m = {
+            { 2.0f, 0.0f, 1.0f, 2.0f },
+            { 0.5f, 3.0f, 0.0f, -3.0f },
+            { 0.0f, 1.0f, 0.5f, 5.0f },
+        };
+
+        const auto i = math::inverse_affine(m);
+        const fvec3 p(1.0f, 2.0f, 3.0f);
+        const auto q = fvec4(p, 1.0f) * m;
+        const auto r = fvec4(q, 1.0f) * i;
+        test_assert(math::abs(r[0] - p[0]) < 1e-5f);
+        test_assert(math::abs(r[1] - p[1]) < 1e-5f);
+        test_assert(math::abs(r[2] - p[2]) < 1e-5f);
+    }
+
+    std::vector<dmat3x3> symmetric_dm33s()
+    {
+        std::vector<dmat3x3> ms = {
+            { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } },
+            { { -2.0, 0.0, 0.0 }, { 0.0, 5.0, 0.0 }, { 0.0, 0.0, 3.0 } },
+            { { 2.0, 1.0, 0.0 }, { 1.0, 2.0, 0.0 }, { 0.0, 0.0, 3.0 } },
+            { { 4.0, 1.0, 2.0 }, { 1.0, -3.0, 0.5 }, { 2.0, 0.5, 1.0 } },
+            { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 } },
+        };
+
+        for (int i = 0; i < 11; ++i)
+        {
+            const auto f = double(i);
+            const auto a = std::sin(f * 1.3), b = std::cos(f * 0.7);
+            const auto c = std::sin(f * 2.9 + 1.0), d = std::cos(f * 0.3);
+            const auto e = std::sin(f * 0.1 + 2.0), g = std::cos(f * 5.0);
+            ms.push_back({ { a, b, c }, { b, d, e }, { c, e, g } });
+        }
+
+        return ms;
+    }
+
+    template<typename T>
+    void check_eigen_symmetric(
+        const mat3x3<T>& m, const vec3<T>& w, const mat3x3<T>& v, T epsilon)
+    {
+        test_assert(w[0] >= w[1] && w[1] >= w[2]);
+        for (int i = 0; i < 3; ++i)
+        {
+            const auto residual = m * v[i] - v[i] * w[i];
+            test_assert(math::length(residual) < epsilon);
+            for (int j = 0; j < 3; ++j)
+            {
+                const auto expected = i == j ? T(1) : T(0);
+                test_assert(
+                    math::abs(math::dot(v[i], v[j]) - expected) < epsilon);
+            }
+        }
+    }
+
+    TEST_CASE(eigen_symmetric)
+    {
+        for (const auto& m : symmetric_dm33s())
+        {
+            dvec3 w;
+            dmat3x3 v;
+            math::eigen_symmetric(m, w, v);
+            check_eigen_symmetric(m, w, v, 1e-12);
+
+            fvec3 fw;
+            fmat3x3 fv;
+            const auto fm = fmat3x3(m);
+            math::eigen_symmetric(fm, fw, fv);
+            check_eigen_symmetric(fm, fw, fv, 1e-5f);
+            for (int i = 0; i < 3; ++i)
+            {
+                test_assert(math::abs(fw[i] - float(w[i])) < 1e-5f);
+            }
+        }
+
+        dvec3 w;
+        dmat3x3 v;
+        math::eigen_symmetric(symmetric_dm33s()[1], w, v);
+        test_assert(w == dvec3(5.0, 3.0, -2.0));
+        test_assert(v[0] == dvec3(0.0, 1.0, 0.0));
+        test_assert(v[1] == dvec3(0.0, 0.0, 1.0));
+        test_assert(v[2] == dvec3(1.0, 0.0, 0.0));
+    }
+
+    TEST_CASE(eigen_symmetric_simd)
+    {
+        const auto ms = symmetric_dm33s();
+        for (std::size_t i = 0; i + 8 <= ms.size(); i += 8)
+        {
+            mat3x3<float32x8> m;
+            for (int j = 0; j < 8; ++j)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    for (int r = 0; r < 3; ++r)
+                    {
+                        m[c][r].data()[j] = float(ms[i+j][c][r]);
+                    }
+                }
+            }
+
+            vec3<float32x8> w;
+            mat3x3<float32x8> v;
+            math::eigen_symmetric(m, w, v);
+            for (int j = 0; j < 8; ++j)
+            {
+                fmat3x3 mj, vj;
+                fvec3 wj;
+                for (int c = 0; c < 3; ++c)
+                {
+                    wj[c] = w[c].data()[j];
+                    for (int r = 0; r < 3; ++r)
+                    {
+                        mj[c][r] = m[c][r].data()[j];
+                        vj[c][r] = v[c][r].data()[j];
+                    }
+                }
+
+                check_eigen_symmetric(mj, wj, vj, 1e-5f);
+            }
+        }
+    }
+
+    std::vector<dmat3x3> general_dm33s()
+    {
+        auto ms = symmetric_dm33s();
+        const dmat3x3 more[] = {
+            { { 2.0, 0.5, 0.0 }, { 0.0, 3.0, 1.0 }, { 1.0, 0.0, 0.5 } },
+            { { 0.0, 1.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } },
+            { { 1.0, 2.0, 3.0 }, { 2.0, 4.0, 6.0 }, { 0.5, 0.0, 1.0 } },
+            { { 1.0, 2.0, 3.0 }, { 2.0, 4.0, 6.0 }, { 3.0, 6.0, 9.0 } },
+        };
+
+        ms.insert(ms.end(), std::begin(more), std::end(more));
+        for (int i = 0; i < 9; ++i)
+        {
+            const auto f = double(i);
+            ms.push_back({
+                { std::sin(f * 1.1), std::cos(f * 2.3), std::sin(f + 0.5) },
+                { std::cos(f * 0.4), std::sin(f * 3.7), std::cos(f * 1.9) },
+                { std::sin(f * 0.8), std::cos(f + 2.0), std::sin(f * 4.1) },
+            });
+        }
+
+        return ms;
+    }
+
+    template<typename T>
+    bool is_rotation(const mat3x3<T>& m, T epsilon)
+    {
+        const mat3x3<T> identity(T(1));
+        return nearly_equal(math::transpose(m) * m, identity, epsilon)
+            && math::abs(math::determinant(m) - T(1)) < epsilon;
+    }
+
+    template<typename T>
+    void check_svd(const mat3x3<T>& m, T epsilon)
+    {
+        mat3x3<T> u, v;
+        vec3<T> s;
+        math::svd(m, u, s, v);
+        test_assert(is_rotation(u, epsilon));
+        test_assert(is_rotation(v, epsilon));
+        test_assert(s[0] >= s[1] - epsilon && s[1] >= -epsilon);
+        test_assert(s[1] >= math::abs(s[2]) - epsilon);
+        test_assert((math::determinant(m) < T(0)) == (s[2] < T(0))
+            || math::abs(s[2]) < epsilon);
+
+        const mat3x3<T> sigma(
+            vec3<T>(s[0], T(0), T(0)),
+            vec3<T>(T(0), s[1], T(0)),
+            vec3<T>(T(0), T(0), s[2]));
+        test_assert(nearly_equal(
+            u * sigma * math::transpose(v), m, epsilon));
+
+        mat3x3<T> r, p;
+        math::polar_decompose(m, r, p);
+        test_assert(is_rotation(r, epsilon));
+        test_assert(nearly_equal(p, math::transpose(p), epsilon));
+        test_assert(nearly_equal(r * p, m, epsilon));
+    }
+
+    TEST_CASE(svd)
+    {
+        for (const auto& m : general_dm33s())
+        {
+            check_svd(m, 1e-10);
+            check_svd(fmat3x3(m), 1e-4f);
+        }
+
+        dmat3x3 u, v;
+        dvec3 s;
+        math::svd(dmat3x3(2.0), u, s, v);
+        test_assert(s == dvec3(2.0, 2.0, 2.0));
+    }
+
+    TEST_CASE(svd_simd)
+    {
+        const auto ms = general_dm33s();
+        for (std::size_t i = 0; i + 4 <= ms.size(); i += 4)
+        {
+            mat3x3<float32x4> m;
+            for (int j = 0; j < 4; ++j)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    for (int r = 0; r < 3; ++r)
+                    {
+                        m[c][r].data()[j] = float(ms[i+j][c][r]);
+                    }
+                }
+            }
+
+            mat3x3<float32x4> u, v, r, p;
+            vec3<float32x4> s;
+            math::svd(m, u, s, v);
+            math::polar_decompose(m, r, p);
+            for (int j = 0; j < 4; ++j)
+            {
+                fmat3x3 mj, uj, vj, rj, pj;
+                fvec3 sj;
+                for (int c = 0; c < 3; ++c)
+                {
+                    sj[c] = s[c].data()[j];
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        mj[c][k] = m[c][k].data()[j];
+                        uj[c][k] = u[c][k].data()[j];
+                        vj[c][k] = v[c][k].data()[j];
+                        rj[c][k] = r[c][k].data()[j];
+                        pj[c][k] = p[c][k].data()[j];
+                    }
+                }
+
+                // The singular vectors are only unique up to sign and
+                // rounding, so only the singular values are compared
+                fmat3x3 eu, ev;
+                fvec3 es;
+                math::svd(mj, eu, es, ev);
+                test_assert(math::length(sj - es) < 1e-5f);
+
+                const fmat3x3 sigma(
+                    fvec3(sj[0], 0.0f, 0.0f),
+                    fvec3(0.0f, sj[1], 0.0f),
+                    fvec3(0.0f, 0.0f, sj[2]));
+                test_assert(is_rotation(uj, 1e-4f));
+                test_assert(is_rotation(vj, 1e-4f));
+                test_assert(nearly_equal(
+                    uj * sigma * math::transpose(vj), mj, 1e-4f));
+                test_assert(nearly_equal(rj * pj, mj, 1e-4f));
+            }
+        }
+    }
+
+    TEST_CASE(solve)
+    {
+        // Symmetric positive-definite, symmetric indefinite, and general
+        const dmat3x3 spd = {
+            { 4.0, 1.0, 2.0 }, { 1.0, 5.0, -1.0 }, { 2.0, -1.0, 6.0 },
+        };
+        const dmat3x3 indefinite = {
+            { 2.0, 1.0, 0.5 }, { 1.0, -3.0, 1.0 }, { 0.5, 1.0, 1.0 },
+        };
+        const dmat3x3 m = {
+            { 3.0, 1.0, -1.0 }, { 2.0, 4.0, 1.0 }, { -1.0, 2.0, 5.0 },
+        };
+        const dvec3 b(1.0, -2.0, 0.5);
+
+        test_assert(math::length(
+            spd * math::solve_cholesky(spd, b) - b) < 1e-12);
+        test_assert(math::length(
+            spd * math::solve_ldlt(spd, b) - b) < 1e-12);
+        test_assert(math::length(
+            indefinite * math::solve_ldlt(indefinite, b) - b) < 1e-12);
+        test_assert(math::length(m * math::solve_lu(m, b) - b) < 1e-12);
+
+        // Only the lower triangle is read
+        auto lower = spd;
+        lower[1][0] = lower[2][0] = lower[2][1] = 100.0;
+        test_assert(math::solve_cholesky(lower, b)
+            == math::solve_cholesky(spd, b));
+        test_assert(math::solve_ldlt(lower, b) == math::solve_ldlt(spd, b));
+
+        mat3x3<float32x8> sm;
+        vec3<float32x8> sb;
+        for (int k = 0; k < 8; ++k)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                sb[c].data()[k] = float(b[c] * (k + 1));
+                for (int r = 0; r < 3; ++r)
+                {
+                    sm[c][r].data()[k] = float(spd[c][r] + (c == r ? k : 0));
+                }
+            }
+        }
+
+        const auto sx1 = math::solve_cholesky(sm, sb);
+        const auto sx2 = math::solve_ldlt(sm, sb);
+        const auto sx3 = math::solve_lu(sm, sb);
+        for (int k = 0; k < 8; ++k)
+        {
+            fmat3x3 mk;
+            fvec3 bk, x1, x2, x3;
+            for (int c = 0; c < 3; ++c)
+            {
+                bk[c] = sb[c].data()[k];
+                x1[c] = sx1[c].data()[k];
+                x2[c] = sx2[c].data()[k];
+                x3[c] = sx3[c].data()[k];
+                for (int r = 0; r < 3; ++r)
+                {
+                    mk[c][r] = sm[c][r].data()[k];
+                }
+            }
+
+            test_assert(math::length(mk * x1 - bk) < 1e-5f);
+            test_assert(math::length(mk * x2 - bk) < 1e-5f);
+            test_assert(math::length(mk * x3 - bk) < 1e-5f);
+        }
+    }
 }
@@ -11,6 +11,7 @@
 
 #include <type_traits>
 #include <tue/math.hpp>
+#include <tue/simd.hpp>
 #include <tue/sized_bool.hpp>
 #include <tue/unused.hpp>
 #include <tue/vec.hpp>
@@ -1315,5 +1316,369 @@ namespace
         test_assert(m3[1] == dm44.row(1));
         test_assert(m3[2] == dm44.row(2));
         test_assert(m3[3] == dm44.row(3));
+
+        CONST_OR_CONSTEXPR auto m4 = math::transpose(fm44);
+        test_assert(m4[0] == fm44.row(0));
+        test_assert(m4[1] == fm44.row(1));
+        test_assert(m4[2] == fm44.row(2));
+        test_assert(m4[3] == fm44.row(3));
+    }
+
+    TEST_CASE(simd_transpose)
+    {
+        const auto m1 = math::simd_transpose(fm44);
+        test_assert(m1 == math::transpose(fm44));
+
+        const auto m2 = math::simd_transpose(dm43);
+        test_assert(m2 == math::transpose(dm43));
+    }
+
+    template<int N, typename T, int C, int R>
+    void check_pack_mats()
+    {
+        mat<T, C, R> ms[N];
+        for (int i = 0; i < N; ++i)
+        {
+            for (int c = 0; c < C; ++c)
+            {
+                for (int r = 0; r < R; ++r)
+                {
+                    ms[i][c][r] = T(100 * i + 10 * c + r);
+                }
+            }
+        }
+
+        const auto m = pack_mats<N>(ms);
+        test_assert((std::is_same<
+            decltype(m), const mat<simd<T, N>, C, R>>::value));
+        for (int i = 0; i < N; ++i)
+        {
+            for (int c = 0; c < C; ++c)
+            {
+                for (int r = 0; r < R; ++r)
+                {
+                    test_assert(m[c][r].data()[i] == ms[i][c][r]);
+                }
+            }
+        }
+
+        mat<T, C, R> unpacked[N];
+        unpack_mats(m, unpacked);
+        for (int i = 0; i < N; ++i)
+        {
+            test_assert(unpacked[i] == ms[i]);
+        }
+    }
+
+    TEST_CASE(pack_mats)
+    {
+        check_pack_mats<4, float, 4, 4>();
+        check_pack_mats<8, float, 4, 4>();
+        check_pack_mats<16, float, 4, 4>();
+        check_pack_mats<2, double, 4, 3>();
+        check_pack_mats<4, int, 4, 2>();
+    }
+
+    template<typename T>
+    bool nearly_identity(const mat4x4<T>& m, T epsilon)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int r = 0; r < 4; ++r)
+            {
+                const auto expected = c == r ? T(1) : T(0);
+                if (math::abs(m[c][r] - expected) >= epsilon)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    CONST_OR_CONSTEXPR dmat4x4 invertible_dm44 = {
+        { 2.0, 0.0, 1.0, 0.0 },
+        { 1.0, 3.0, 0.0, 1.0 },
+        { 0.0, 1.0, 4.0, 0.0 },
+        { 1.0, 0.0, 0.0, 5.0 },
+    };
+
+    TEST_CASE(determinant)
+    {
+        CONST_OR_CONSTEXPR auto d = math::determinant(invertible_dm44);
+        test_assert(nearly_equal(d, 124.0));
+        test_assert(nearly_equal(
+            math::determinant(math::transpose(invertible_dm44)), 124.0));
+        test_assert(nearly_equal(
+            math::determinant(fmat4x4(invertible_dm44)), 124.0f));
+        test_assert(math::determinant(fm44) == math::determinant(fm44));
+    }
+
+    TEST_CASE(inverse)
+    {
+        CONST_OR_CONSTEXPR auto di = math::inverse(invertible_dm44);
+        test_assert(nearly_identity(invertible_dm44 * di, 1e-12));
+        test_assert(nearly_identity(di * invertible_dm44, 1e-12));
+
+        CONST_OR_CONSTEXPR fmat4x4 fm = {
+            { 0.5f, -1.0f, 2.0f, 0.25f },
+            { 3.0f, 1.5f, -0.5f, 1.0f },
+            { -2.0f, 0.0f, 1.0f, 4.0f },
+            { 1.0f, 2.0f, 3.0f, -1.0f },
+        };
+
+        CONST_OR_CONSTEXPR auto fi = math::inverse(fm);
+        test_assert(nearly_identity(fm * fi, 1e-5f));
+        test_assert(nearly_identity(fi * fm, 1e-5f));
+
+        const auto si = math::simd_inverse(fm);
+        test_assert(nearly_identity(fm * si, 1e-5f));
+        test_assert(nearly_identity(si * fm, 1e-5f));
+
+        const auto expected = fmat4x4(math::inverse(dmat4x4(fm)));
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int r = 0; r < 4; ++r)
+            {
+                test_assert(math::abs(fi[c][r] - expected[c][r]) < 1e-5f);
+                test_assert(math::abs(si[c][r] - expected[c][r]) < 1e-5f);
+            }
+        }
+
+        const auto di2 = math::simd_inverse(invertible_dm44);
+        test_assert(di2 == math::inverse(invertible_dm44));
+    }
+
+    TEST_CASE(inverse_simd)
+    {
+        mat4x4<float32x8> sm;
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int r = 0; r < 4; ++r)
+            {
+                for (int k = 0; k < 8; ++k)
+                {
+                    sm[c][r].data()[k] = float(invertible_dm44[c][r])
+                        + (c == r ? float(k) : float(k % 3) * 0.25f);
+                }
+            }
+        }
+
+        const auto si = math::inverse(sm);
+        const auto sp = sm * si;
+        for (int k = 0; k < 8; ++k)
+        {
+            fmat4x4 p;
+            for (int c = 0; c < 4; ++c)
+            {
+                for (int r = 0; r < 4; ++r)
+                {
+                    p[c][r] = sp[c][r].data()[k];
+                }
+            }
+
+            test_assert(nearly_identity(p, 1e-5f));
+        }
+    }
+
+    // A rotation (using a 3-4-5 triangle so every component is exact) and
+    // then a translation, in the same layout as transform::translation_mat()
+    CONST_OR_CONSTEXPR dmat4x4 rigid_dm44 = {
+        { 0.6, 0.0, -0.8, 2.0 },
+        { 0.0, 1.0, 0.0, -3.0 },
+        { 0.8, 0.0, 0.6, 5.0 },
+        { 0.0, 0.0, 0.0, 1.0 },
+    };
+
+    CONST_OR_CONSTEXPR dmat4x4 affine_dm44 = {
+        { 2.0, 0.5, 0.0, 2.0 },
+        { 0.0, 3.0, 1.0, -3.0 },
+        { 1.0, 0.0, 0.5, 5.0 },
+        { 0.0, 0.0, 0.0, 1.0 },
+    };
+
+    TEST_CASE(inverse_rigid)
+    {
+        CONST_OR_CONSTEXPR auto m = math::inverse_rigid(rigid_dm44);
+        test_assert(nearly_identity(rigid_dm44 * m, 1e-12));
+        test_assert(nearly_identity(m * rigid_dm44, 1e-12));
+
+        const auto fm = fmat4x4(rigid_dm44);
+        test_assert(nearly_identity(fm * math::inverse_rigid(fm), 1e-6f));
+
+        // mat4x3 is the transpose form with the translation in column 3
+        const auto m43 = fmat4x3(math::transpose(fm));
+        const auto i43 = math::inverse_rigid(m43);
+        const fvec3 p(1.0f, 2.0f, 3.0f);
+        const auto q = m43 * fvec4(p, 1.0f);
+        const auto r = i43 * fvec4(q, 1.0f);
+        test_assert(math::abs(r[0] - p[0]) < 1e-5f);
+        test_assert(math::abs(r[1] - p[1]) < 1e-5f);
+        test_assert(math::abs(r[2] - p[2]) < 1e-5f);
+    }
+
+    TEST_CASE(inverse_affine)
+    {
+        CONST_OR_CONSTEXPR auto m = math::inverse_affine(affine_dm44);
+        test_assert(nearly_identity(affine_dm44 * m, 1e-12));
+        test_assert(nearly_identity(m * affine_dm44, 1e-12));
+
+        const auto expected = math::inverse(affine_dm44);
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int r = 0; r < 4; ++r)
+            {
+                test_assert(math::abs(m[c][r] - expected[c][r]) < 1e-12);
+            }
+        }
+
+        const auto m43 = dmat4x3(math::transpose(affine_dm44));
+        const auto i43 = math::inverse_affine(m43);
+        const auto t43 = math::transpose(expected);
+        for (int c = 0; c < 4; ++c)
+        {
+            test_assert(math::abs(i43[c][0] - t43[c][0]) < 1e-12);
+            test_assert(math::abs(i43[c][1] - t43[c][1]) < 1e-12);
+            test_assert(math::abs(i43[c][2] - t43[c][2]) < 1e-12);
+        }
+
+        mat4x4<float64x2> sm(affine_dm44);
+        sm[0][0] = float64x2(2.0, 4.0);
+        const auto si = math::inverse_affine(sm);
+        const auto sp = sm * si;
+        for (int k = 0; k < 2; ++k)
+        {
+            dmat4x4 p;
+            for (int c = 0; c < 4; ++c)
+            {
+                for (int r = 0; r < 4; ++r)
+                {
+                    p[c][r] = sp[c][r].data()[k];
+                }
+            }
+
+            test_assert(nearly_identity(p, 1e-12));
+        }
+    }
+
+    TEST_CASE(affine_mult)
+    {
+        const auto expected = affine_dm44 * rigid_dm44;
+
+        const auto m34 = math::affine_mult(
+            dmat3x4(affine_dm44), dmat3x4(rigid_dm44));
+        test_assert((std::is_same<decltype(m34), const dmat3x4>::value));
+        const auto m43 = math::affine_mult(
+            dmat4x3(math::transpose(rigid_dm44)),
+            dmat4x3(math::transpose(affine_dm44)));
+        test_assert((std::is_same<decltype(m43), const dmat4x3>::value));
+        const auto t43 = math::transpose(expected);
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int r = 0; r < 4; ++r)
+            {
+                test_assert(math::abs(
+                    dmat4x4(m34)[c][r] - expected[c][r]) < 1e-12);
+                test_assert(math::abs(
+                    dmat4x4(m43)[c][r] - t43[c][r]) < 1e-12);
+            }
+        }
+
+        const auto fa = fmat3x4(dmat3x4(affine_dm44));
+        const auto fm = math::affine_mult(fa, math::inverse_affine(fa));
+        test_assert(nearly_identity(fmat4x4(fm), 1e-6f));
+
+        const auto sm = math::affine_mult(
+            mat3x4<float64x2>(dmat3x4(affine_dm44)),
+            mat3x4<float64x2>(dmat3x4(rigid_dm44)));
+        for (int c = 0; c < 3; ++c)
+        {
+            for (int r = 0; r < 4; ++r)
+            {
+                test_assert(math::abs(
+                    sm[c][r].data()[1] - expected[c][r]) < 1e-12);
+            }
+        }
+    }
+
+    TEST_CASE(solve)
+    {
+        const auto spd = math::transpose(invertible_dm44) * invertible_dm44;
+        const dvec4 b(1.0, -2.0, 0.5, 3.0);
+        test_assert(math::length(
+            spd * math::solve_cholesky(spd, b) - b) < 1e-10);
+        test_assert(math::length(
+            spd * math::solve_ldlt(spd, b) - b) < 1e-10);
+        test_assert(math::length(
+            invertible_dm44 * math::solve_lu(invertible_dm44, b) - b) < 1e-10);
+
+        const auto fm = fmat4x4(invertible_dm44);
+        const auto fb = fvec4(b);
+        const auto fx = math::solve_lu(fm, fb);
+        test_assert(math::length(fm * fx - fb) < 1e-4f);
+
+        const mat4x4<float64x2> sm(spd);
+        const vec4<float64x2> sb(b);
+        const auto sx = math::solve_cholesky(sm, sb);
+        for (int k = 0; k < 2; ++k)
+        {
+            const dvec4 xk(sx[0].data()[k], sx[1].data()[k],
+                sx[2].data()[k], sx[3].data()[k]);
+            test_assert(math::length(spd * xk - b) < 1e-10);
+        }
+    }
+
+    TEST_CASE(solve_arrays)
+    {
+        // Symmetric and diagonally dominant in every lane, and a general
+        // diagonally dominant one for LU
+        float32x8 spd[6][6], m[6][6], b[6];
+        for (int k = 0; k < 8; ++k)
+        {
+            for (int c = 0; c < 6; ++c)
+            {
+                b[c].data()[k] = float(c) - 2.5f + float(k);
+                for (int r = 0; r < 6; ++r)
+                {
+                    const auto d = c > r ? c - r : r - c;
+                    spd[c][r].data()[k] = 1.0f / float(1 + d)
+                        + (c == r ? 6.0f + float(k) : 0.0f);
+                    m[c][r].data()[k] = spd[c][r].data()[k] + 0.1f * float(c);
+                }
+            }
+        }
+
+        const auto x1 = math::solve_cholesky(spd, b);
+        const auto x2 = math::solve_ldlt(spd, b);
+        const auto x3 = math::solve_lu(m, b);
+        for (int k = 0; k < 8; ++k)
+        {
+            for (int r = 0; r < 6; ++r)
+            {
+                auto r1 = -b[r].data()[k];
+                auto r2 = r1;
+                auto r3 = r1;
+                for (int c = 0; c < 6; ++c)
+                {
+                    r1 += spd[c][r].data()[k] * x1[c].data()[k];
+                    r2 += spd[c][r].data()[k] * x2[c].data()[k];
+                    r3 += m[c][r].data()[k] * x3[c].data()[k];
+                }
+
+                test_assert(math::abs(r1) < 1e-5f);
+                test_assert(math::abs(r2) < 1e-5f);
+                test_assert(math::abs(r3) < 1e-5f);
+            }
+        }
+
+        // The same as mat for sizes it supports
+        const dmat2x2 dm = { { 4.0, 1.0 }, { 2.0, 3.0 } };
+        const double dma[2][2] = { { 4.0, 1.0 }, { 2.0, 3.0 } };
+        const double db[2] = { 1.0, -2.0 };
+        const auto dx = math::solve_lu(dma, db);
+        const auto ex = math::solve_lu(dm, dvec2(1.0, -2.0));
+        test_assert(dx[0] == ex[0]);
+        test_assert(dx[1] == ex[1]);
     }
 }
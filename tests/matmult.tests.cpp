@@ -819,4 +819,80 @@ namespace
         test_assert(nearly_equal(
             m[3][3], math::dot(fm44.row(3), dm44.column(3))));
     }
+
+    TEST_CASE(same_type_products_are_constexpr)
+    {
+        CONST_OR_CONSTEXPR auto m =
+            fmat4x4::identity() * fmat4x4::identity();
+        test_assert(m == fmat4x4::identity());
+
+        CONST_OR_CONSTEXPR auto v = fm44 * fv4;
+        test_assert(v == math::simd_mult(fm44, fv4));
+
+        CONST_OR_CONSTEXPR auto m2 = math::affine_mult(fm43, fm43);
+        test_assert(m2 == fmat4x3(fmat4x4(fm43) * fmat4x4(fm43)));
+    }
+
+    TEST_CASE(simd_mult_mat_vec)
+    {
+        const auto v1 = math::simd_mult(fm44, fv4);
+        test_assert(nearly_equal(v1[0], math::dot(fm44.row(0), fv4)));
+        test_assert(nearly_equal(v1[1], math::dot(fm44.row(1), fv4)));
+        test_assert(nearly_equal(v1[2], math::dot(fm44.row(2), fv4)));
+        test_assert(nearly_equal(v1[3], math::dot(fm44.row(3), fv4)));
+
+        const auto v2 = math::simd_mult(fm43, fv4);
+        test_assert(nearly_equal(v2[0], math::dot(fm43.row(0), fv4)));
+        test_assert(nearly_equal(v2[1], math::dot(fm43.row(1), fv4)));
+        test_assert(nearly_equal(v2[2], math::dot(fm43.row(2), fv4)));
+
+        const auto v3 = math::simd_mult(dm34, dv3);
+        test_assert(nearly_equal(v3[0], math::dot(dm34.row(0), dv3)));
+        test_assert(nearly_equal(v3[1], math::dot(dm34.row(1), dv3)));
+        test_assert(nearly_equal(v3[2], math::dot(dm34.row(2), dv3)));
+        test_assert(nearly_equal(v3[3], math::dot(dm34.row(3), dv3)));
+
+        // No simd path for two rows
+        test_assert(math::simd_mult(fm22, fv2) == fm22 * fv2);
+    }
+
+    template<typename T, int C, int N, int R>
+    void check_simd_mult(const mat<T, N, R>& lhs, const mat<T, C, N>& rhs)
+    {
+        const auto m1 = math::simd_mult(lhs, rhs);
+        const auto m2 = lhs * rhs;
+        for (int i = 0; i < C; ++i)
+        {
+            for (int j = 0; j < R; ++j)
+            {
+                const auto expected = math::dot(lhs.row(j), rhs.column(i));
+                test_assert(nearly_equal(m1[i][j], expected));
+                test_assert(nearly_equal(m2[i][j], expected));
+            }
+        }
+    }
+
+    TEST_CASE(simd_mult_mat_mat)
+    {
+        check_simd_mult(fm44, fm44);
+        check_simd_mult(fm44, fm34);
+        check_simd_mult(fm44, fm24);
+        check_simd_mult(fm34, fm43);
+        check_simd_mult(fm34, fm33);
+        check_simd_mult(fm43, fm44);
+        check_simd_mult(fm43, fm34);
+        check_simd_mult(fm33, fm33);
+        check_simd_mult(fm22, fm22);
+
+        check_simd_mult(dm44, dm44);
+        check_simd_mult(dm34, dm43);
+        check_simd_mult(dm43, dm24);
+    }
+
+    TEST_CASE(fmat4x4_times_equals_fmat4x4)
+    {
+        auto m = fm44;
+        m *= fm44;
+        test_assert(m == fm44 * fm44);
+    }
 }
@@ -0,0 +1,129 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/memory.hpp>
+#include "tue.tests.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    bool is_aligned(const void* p, std::size_t alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+    }
+
+    TEST_CASE(aligned_allocator_alignment)
+    {
+        test_assert(aligned_allocator<float>::alignment == alignof(float));
+        test_assert(aligned_allocator<float32x8>::alignment
+            == alignof(float32x8));
+        test_assert((aligned_allocator<float, 64>::alignment == 64));
+        test_assert((aligned_allocator<float32x4, 8>::alignment
+            == alignof(float32x4)));
+
+        aligned_allocator<float32x16> a;
+        for (std::size_t n = 1; n < 16; ++n)
+        {
+            const auto p = a.allocate(n);
+            test_assert(is_aligned(p, alignof(float32x16)));
+            a.deallocate(p, n);
+        }
+    }
+
+    TEST_CASE(aligned_allocator_vector)
+    {
+        std::vector<vec3<float32x8>, aligned_allocator<vec3<float32x8>>> v;
+        for (int i = 0; i < 33; ++i)
+        {
+            v.push_back(vec3<float32x8>(float32x8(float(i))));
+            test_assert(is_aligned(v.data(), alignof(float32x8)));
+        }
+
+        test_assert(v[32][2] == float32x8(32.0f));
+    }
+
+    TEST_CASE(aligned_allocator_rebind)
+    {
+        using A = aligned_allocator<float, 64>;
+        using B = std::allocator_traits<A>::rebind_alloc<double>;
+        test_assert((std::is_same<B, aligned_allocator<double, 64>>::value));
+
+        const A a;
+        const B b(a);
+        test_assert(a == b);
+        test_assert(!(a != b));
+    }
+
+    TEST_CASE(simd_arena_allocate)
+    {
+        simd_arena arena(1024);
+        test_assert(arena.capacity() == 1024);
+        test_assert(arena.size() == 0);
+
+        const auto c = arena.allocate<char>(3);
+        test_assert(c != nullptr);
+        test_assert(arena.size() == 3);
+
+        const auto s = arena.allocate<float32x8>(2);
+        test_assert(s != nullptr);
+        test_assert(is_aligned(s, alignof(float32x8)));
+        test_assert(static_cast<void*>(s) > static_cast<void*>(c));
+        test_assert(arena.size() == alignof(float32x8) + 2 * sizeof(float32x8));
+
+        const auto p = arena.allocate(16, 128);
+        test_assert(p != nullptr);
+        test_assert(is_aligned(p, 128));
+    }
+
+    TEST_CASE(simd_arena_exhaustion)
+    {
+        simd_arena arena(256);
+        test_assert(arena.allocate<float32x4>(16) != nullptr);
+        test_assert(arena.allocate<float32x4>(1) == nullptr);
+        test_assert(arena.size() == 256);
+
+        arena.reset();
+        test_assert(arena.size() == 0);
+        test_assert(arena.allocate<float32x4>(16) != nullptr);
+    }
+
+    TEST_CASE(simd_arena_reset)
+    {
+        simd_arena arena(512);
+        const auto p1 = arena.allocate<vec3<float32x4>>(2);
+        arena.reset();
+        const auto p2 = arena.allocate<vec3<float32x4>>(2);
+        test_assert(p1 == p2);
+    }
+
+    TEST_CASE(simd_arena_move)
+    {
+        simd_arena a1(128);
+        const auto p = a1.allocate<float32x4>();
+        test_assert(p != nullptr);
+
+        simd_arena a2(std::move(a1));
+        test_assert(a1.capacity() == 0);
+        test_assert(a1.allocate<float32x4>() == nullptr);
+        test_assert(a2.capacity() == 128);
+        test_assert(a2.size() == sizeof(float32x4));
+
+        simd_arena a3(64);
+        a3 = std::move(a2);
+        test_assert(a3.capacity() == 128);
+        test_assert(a2.capacity() == 0);
+    }
+}
@@ -0,0 +1,224 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/normalized.hpp>
+#include "tue.tests.hpp"
+
+#include <cstdint>
+#include <limits>
+
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+
+    TEST_CASE(size)
+    {
+        test_assert(sizeof(unorm8) == 1);
+        test_assert(sizeof(unorm16) == 2);
+        test_assert(sizeof(snorm8) == 1);
+        test_assert(sizeof(snorm16) == 2);
+        test_assert(sizeof(vec4<unorm8>) == 4);
+        test_assert(is_vec_component<unorm8>::value);
+        test_assert(is_vec_component<snorm16>::value);
+    }
+
+    TEST_CASE(from_bits)
+    {
+        CONST_OR_CONSTEXPR auto u = unorm8::from_bits(255);
+        CONST_OR_CONSTEXPR auto s = snorm16::from_bits(-32767);
+        test_assert(u.bits() == 255);
+        test_assert(s.bits() == -32767);
+        test_assert(float(u) == 1.0f);
+        test_assert(float(s) == -1.0f);
+    }
+
+    TEST_CASE(unorm_from_float)
+    {
+        test_assert(unorm8(0.0f).bits() == 0);
+        test_assert(unorm8(1.0f).bits() == 255);
+        test_assert(unorm8(0.5f).bits() == 128);
+        test_assert(unorm8(-0.5f).bits() == 0);
+        test_assert(unorm8(2.0f).bits() == 255);
+        test_assert(unorm8(inf).bits() == 255);
+        test_assert(unorm8(-inf).bits() == 0);
+        test_assert(unorm8(nan).bits() == 0);
+        test_assert(unorm16(1.0f).bits() == 65535);
+        test_assert(unorm16(0.25f).bits() == 16384);
+    }
+
+    TEST_CASE(snorm_from_float)
+    {
+        test_assert(snorm8(0.0f).bits() == 0);
+        test_assert(snorm8(-0.0f).bits() == 0);
+        test_assert(snorm8(1.0f).bits() == 127);
+        test_assert(snorm8(-1.0f).bits() == -127);
+        test_assert(snorm8(-2.0f).bits() == -127);
+        test_assert(snorm8(2.0f).bits() == 127);
+        test_assert(snorm8(0.5f).bits() == 64);
+        test_assert(snorm8(-0.5f).bits() == -64);
+        test_assert(snorm8(nan).bits() == 0);
+        test_assert(snorm16(-1.0f).bits() == -32767);
+        test_assert(snorm16(-inf).bits() == -32767);
+    }
+
+    TEST_CASE(to_float)
+    {
+        test_assert(float(unorm8::from_bits(0)) == 0.0f);
+        test_assert(float(unorm16::from_bits(65535)) == 1.0f);
+        test_assert(float(snorm8::from_bits(127)) == 1.0f);
+        test_assert(float(snorm8::from_bits(-127)) == -1.0f);
+        test_assert(float(snorm8::from_bits(-128)) == -1.0f);
+        test_assert(float(snorm16::from_bits(-32768)) == -1.0f);
+        test_assert(nearly_equal(float(unorm8::from_bits(51)), 0.2f));
+    }
+
+    TEST_CASE(round_trip)
+    {
+        for (int i = 0; i < 0x10000; ++i)
+        {
+            const auto u16 = unorm16::from_bits(std::uint16_t(i));
+            const auto s16 = snorm16::from_bits(std::int16_t(i - 0x8000));
+            test_assert(unorm16(float(u16)).bits() == u16.bits());
+            if (s16.bits() != -32768)
+            {
+                test_assert(snorm16(float(s16)).bits() == s16.bits());
+            }
+        }
+    }
+
+    TEST_CASE(vec_conversion)
+    {
+        const vec4<unorm8> c(
+            unorm8(1.0f), unorm8(0.0f), unorm8::from_bits(51), unorm8(0.5f));
+        const fvec4 f(c);
+        test_assert(f[0] == 1.0f);
+        test_assert(f[1] == 0.0f);
+        test_assert(nearly_equal(f[2], 0.2f));
+
+        const vec3<snorm16> n(fvec3(0.0f, -1.0f, 2.0f));
+        test_assert(n[0].bits() == 0);
+        test_assert(n[1].bits() == -32767);
+        test_assert(n[2].bits() == 32767);
+    }
+
+    TEST_CASE(unpack)
+    {
+        std::uint8_t u8[16];
+        std::int8_t s8[16];
+        for (int i = 0; i < 16; ++i)
+        {
+            u8[i] = std::uint8_t(i * 17);
+            s8[i] = std::int8_t(i * 17 - 128);
+        }
+
+        const auto fu8 = unpack_unorm(uint8x16::loadu(u8));
+        const auto fs8 = unpack_snorm(int8x16::loadu(s8));
+        for (int i = 0; i < 16; ++i)
+        {
+            test_assert(fu8.data()[i] == float(unorm8::from_bits(u8[i])));
+            test_assert(fs8.data()[i] == float(snorm8::from_bits(s8[i])));
+        }
+
+        const uint16x8 u16(0, 1, 2, 32767, 32768, 65533, 65534, 65535);
+        const auto fu16 = unpack_unorm(u16);
+        const auto fs16 = unpack_snorm(
+            int16x8(-32768, -32767, -1, 0, 1, 2, 32766, 32767));
+        for (int i = 0; i < 8; ++i)
+        {
+            test_assert(fu16.data()[i]
+                == float(unorm16::from_bits(u16.data()[i])));
+        }
+
+        test_assert(fs16.data()[0] == -1.0f);
+        test_assert(fs16.data()[1] == -1.0f);
+        test_assert(fs16.data()[3] == 0.0f);
+        test_assert(fs16.data()[7] == 1.0f);
+
+        const auto f4 = unpack_unorm(simd<std::uint8_t, 4>(0, 51, 102, 255));
+        test_assert(f4.data()[0] == 0.0f);
+        test_assert(nearly_equal(f4.data()[1], 0.2f));
+        test_assert(f4.data()[3] == 1.0f);
+
+        const auto f32 = unpack_snorm(simd<std::int8_t, 32>(-127));
+        test_assert((f32 == simd<float, 32>(-1.0f)));
+    }
+
+    TEST_CASE(pack)
+    {
+        const float32x16 f(
+            -1.0f, 0.0f, 0.25f, 0.5f, 0.75f, 1.0f, 2.0f, nan,
+            -inf, inf, -0.5f, 1.0f / 255, 0.5f / 255, 0.499f / 255,
+            0.999f, -0.0f);
+
+        const auto u8 = pack_unorm<std::uint8_t>(f);
+        const auto s8 = pack_snorm<std::int8_t>(f);
+        for (int i = 0; i < 16; ++i)
+        {
+            test_assert(u8.data()[i] == unorm8(f.data()[i]).bits());
+            test_assert(s8.data()[i] == snorm8(f.data()[i]).bits());
+        }
+
+        const auto lo = reinterpret_cast<const float32x8*>(&f);
+        for (int h = 0; h < 2; ++h)
+        {
+            const auto u16 = pack_unorm<std::uint16_t>(lo[h]);
+            const auto s16 = pack_snorm<std::int16_t>(lo[h]);
+            for (int i = 0; i < 8; ++i)
+            {
+                test_assert(u16.data()[i]
+                    == unorm16(lo[h].data()[i]).bits());
+                test_assert(s16.data()[i]
+                    == snorm16(lo[h].data()[i]).bits());
+            }
+        }
+
+        const auto u2 = pack_unorm<std::uint16_t>(float32x2(0.5f, 1.0f));
+        test_assert(u2 == (simd<std::uint16_t, 2>(32768, 65535)));
+    }
+
+    TEST_CASE(convert_n)
+    {
+        float f1[37];
+        for (int i = 0; i < 37; ++i)
+        {
+            f1[i] = float(i) / 18.0f - 1.0f;
+        }
+
+        unorm8 u8[37];
+        snorm8 s8[37];
+        unorm16 u16[37];
+        snorm16 s16[37];
+        convert_n(f1, 37, u8);
+        convert_n(f1, 37, s8);
+        convert_n(f1, 37, u16);
+        convert_n(f1, 37, s16);
+
+        float f2[37];
+        convert_n(s16, 37, f2);
+        for (int i = 0; i < 37; ++i)
+        {
+            test_assert(u8[i].bits() == unorm8(f1[i]).bits());
+            test_assert(s8[i].bits() == snorm8(f1[i]).bits());
+            test_assert(u16[i].bits() == unorm16(f1[i]).bits());
+            test_assert(s16[i].bits() == snorm16(f1[i]).bits());
+            test_assert(nearly_equal(f2[i] + 2.0f, f1[i] + 2.0f));
+        }
+
+        convert_n(u8, 37, f2);
+        for (int i = 0; i < 37; ++i)
+        {
+            test_assert(f2[i] == float(u8[i]));
+        }
+    }
+}
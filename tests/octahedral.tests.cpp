@@ -0,0 +1,156 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/octahedral.hpp>
+#include "tue.tests.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include <tue/float16.hpp>
+#include <tue/math.hpp>
+#include <tue/normalized.hpp>
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    std::vector<fvec3> test_normals()
+    {
+        std::vector<fvec3> normals = {
+            fvec3(1.0f, 0.0f, 0.0f), fvec3(-1.0f, 0.0f, 0.0f),
+            fvec3(0.0f, 1.0f, 0.0f), fvec3(0.0f, -1.0f, 0.0f),
+            fvec3(0.0f, 0.0f, 1.0f), fvec3(0.0f, 0.0f, -1.0f),
+        };
+
+        // A spiral over the whole sphere
+        for (int i = 0; i < 197; ++i)
+        {
+            const auto z = 1.0f - (float(i) + 0.5f) * (2.0f / 197.0f);
+            const auto r = std::sqrt(1.0f - z*z);
+            const auto a = float(i) * 2.39996323f;
+            normals.push_back(fvec3(r * std::cos(a), r * std::sin(a), z));
+        }
+
+        return normals;
+    }
+
+    float cos_angle(const fvec3& expected, const fvec3& actual)
+    {
+        return math::dot(expected, math::normalize(actual));
+    }
+
+    TEST_CASE(octahedral_encode_axes)
+    {
+        test_assert(octahedral_encode(fvec3(0.0f, 0.0f, 1.0f))
+            == fvec2(0.0f, 0.0f));
+        test_assert(octahedral_encode(fvec3(1.0f, 0.0f, 0.0f))
+            == fvec2(1.0f, 0.0f));
+        test_assert(octahedral_encode(fvec3(0.0f, -1.0f, 0.0f))
+            == fvec2(0.0f, -1.0f));
+
+        const auto e = octahedral_encode(fvec3(0.0f, 0.0f, -1.0f));
+        test_assert(math::abs(e[0]) == 1.0f);
+        test_assert(math::abs(e[1]) == 1.0f);
+
+        // Unnormalized input encodes the same direction
+        test_assert(octahedral_encode(fvec3(3.0f, 0.0f, 0.0f))
+            == fvec2(1.0f, 0.0f));
+    }
+
+    TEST_CASE(octahedral_round_trip)
+    {
+        for (const auto& n : test_normals())
+        {
+            const auto e = octahedral_encode(n);
+            test_assert(math::abs(e[0]) <= 1.0f);
+            test_assert(math::abs(e[1]) <= 1.0f);
+
+            const auto d = octahedral_decode(e);
+            test_assert(nearly_equal(d[0] + 2.0f, n[0] + 2.0f));
+            test_assert(nearly_equal(d[1] + 2.0f, n[1] + 2.0f));
+            test_assert(nearly_equal(d[2] + 2.0f, n[2] + 2.0f));
+        }
+    }
+
+    TEST_CASE(octahedral_simd_matches_scalar)
+    {
+        const auto normals = test_normals();
+        for (std::size_t i = 0; i + 4 <= normals.size(); i += 4)
+        {
+            vec3<float32x4> n;
+            for (int j = 0; j < 4; ++j)
+            {
+                n[0].data()[j] = normals[i+j][0];
+                n[1].data()[j] = normals[i+j][1];
+                n[2].data()[j] = normals[i+j][2];
+            }
+
+            const auto e = octahedral_encode(n);
+            const auto d = octahedral_decode(e);
+            for (int j = 0; j < 4; ++j)
+            {
+                const auto expected = octahedral_encode(normals[i+j]);
+                test_assert(e[0].data()[j] == expected[0]);
+                test_assert(e[1].data()[j] == expected[1]);
+
+                const fvec3 actual(
+                    d[0].data()[j], d[1].data()[j], d[2].data()[j]);
+                test_assert(cos_angle(normals[i+j], actual) > 0.99999f);
+                test_assert(math::abs(math::length(actual) - 1.0f) < 0.001f);
+            }
+        }
+    }
+
+    TEST_CASE(octahedral_snorm16)
+    {
+        const auto normals = test_normals();
+        std::vector<snorm16> encoded(2 * normals.size());
+        std::vector<fvec3> decoded(normals.size());
+        octahedral_encode_n(normals.data(), normals.size(), encoded.data());
+        octahedral_decode_n(encoded.data(), normals.size(), decoded.data());
+
+        for (std::size_t i = 0; i < normals.size(); ++i)
+        {
+            const auto e = octahedral_encode(normals[i]);
+            test_assert(encoded[2*i].bits() == snorm16(e[0]).bits());
+            test_assert(encoded[2*i+1].bits() == snorm16(e[1]).bits());
+            test_assert(cos_angle(normals[i], decoded[i]) > 0.99999f);
+        }
+    }
+
+    TEST_CASE(octahedral_snorm8)
+    {
+        const auto normals = test_normals();
+        std::vector<snorm8> encoded(2 * normals.size());
+        std::vector<fvec3> decoded(normals.size());
+        octahedral_encode_n(normals.data(), normals.size(), encoded.data());
+        octahedral_decode_n(encoded.data(), normals.size(), decoded.data());
+
+        for (std::size_t i = 0; i < normals.size(); ++i)
+        {
+            test_assert(cos_angle(normals[i], decoded[i]) > 0.999f);
+        }
+    }
+
+    TEST_CASE(octahedral_float16)
+    {
+        const auto normals = test_normals();
+        std::vector<float16> encoded(2 * normals.size());
+        std::vector<fvec3> decoded(normals.size());
+        octahedral_encode_n(normals.data(), normals.size(), encoded.data());
+        octahedral_decode_n(encoded.data(), normals.size(), decoded.data());
+
+        for (std::size_t i = 0; i < normals.size(); ++i)
+        {
+            test_assert(cos_angle(normals[i], decoded[i]) > 0.99999f);
+        }
+    }
+}
@@ -9,6 +9,9 @@
 #include <tue/quat.hpp>
 #include "tue.tests.hpp"
 
+#include <cmath>
+
+#include <tue/simd.hpp>
 #include <tue/unused.hpp>
 #include <tue/vec.hpp>
 
@@ -357,4 +360,124 @@ namespace
         CONST_OR_CONSTEXPR auto q = math::conjugate(dquat(1.2, 3.4, 5.6, 7.8));
         test_assert(q == dquat(-1.2, -3.4, -5.6, 7.8));
     }
+
+    TEST_CASE(rotate)
+    {
+        CONST_OR_CONSTEXPR dvec3 v1(1.2, 3.4, 5.6);
+        CONST_OR_CONSTEXPR fquat q(0.5f, -0.5f, 0.5f, 0.5f);
+        CONST_OR_CONSTEXPR auto v2 = math::rotate(v1, q);
+        test_assert(math::length(v2 - v1 * q) < 1e-12);
+
+        const auto q2 = math::normalize(dquat(7.8, -9.10, 11.12, 13.14));
+        test_assert(math::length(math::rotate(v1, q2) - v1 * q2) < 1e-12);
+
+        const quat<float32x4> q3(q);
+        const auto v3 = math::rotate(vec3<float32x4>(fvec3(v1)), q3);
+        for (int i = 0; i < 4; ++i)
+        {
+            const fvec3 lane(v3[0].data()[i], v3[1].data()[i], v3[2].data()[i]);
+            test_assert(math::length(lane - fvec3(v1) * q) < 1e-5f);
+        }
+    }
+
+    template<typename T>
+    quat<T> z_rotation(T angle)
+    {
+        return { T(0), T(0), std::sin(angle / 2), std::cos(angle / 2) };
+    }
+
+    template<typename T, int N>
+    quat<T> lane(const quat<simd<T, N>>& q, int i)
+    {
+        return {
+            q[0].data()[i], q[1].data()[i], q[2].data()[i], q[3].data()[i],
+        };
+    }
+
+    TEST_CASE(nlerp)
+    {
+        const auto q1 = z_rotation(0.0);
+        const auto q2 = z_rotation(1.0);
+        test_assert(nearly_equal(math::nlerp(q1, q2, 0.0), q1, 1e-12));
+        test_assert(nearly_equal(math::nlerp(q1, q2, 1.0), q2, 1e-12));
+        test_assert(nearly_equal(
+            math::nlerp(q1, q2, 0.5), z_rotation(0.5), 1e-12));
+
+        const dquat q3(-q2[0], -q2[1], -q2[2], -q2[3]);
+        test_assert(nearly_equal(
+            math::nlerp(q1, q3, 0.5), z_rotation(0.5), 1e-12));
+    }
+
+    TEST_CASE(slerp)
+    {
+        const auto q1 = z_rotation(0.25);
+        const auto q2 = z_rotation(2.5);
+        for (double t = 0.0; t <= 1.0; t += 0.125)
+        {
+            const auto expected = z_rotation(0.25 + 2.25*t);
+            test_assert(nearly_equal(
+                math::slerp(q1, q2, t), expected, 1e-7));
+        }
+
+        const dquat q3(-q2[0], -q2[1], -q2[2], -q2[3]);
+        test_assert(nearly_equal(
+            math::slerp(q1, q3, 0.25), z_rotation(0.8125), 1e-7));
+
+        const auto q4 = z_rotation(0.26);
+        test_assert(nearly_equal(
+            math::slerp(q1, q4, 0.5), z_rotation(0.255), 1e-7));
+    }
+
+    TEST_CASE(fast_slerp)
+    {
+        const auto q1 = z_rotation(0.25);
+        const auto q2 = z_rotation(2.5);
+        for (double t = 0.0; t <= 1.0; t += 0.125)
+        {
+            test_assert(nearly_equal(
+                math::fast_slerp(q1, q2, t), math::slerp(q1, q2, t), 1e-3));
+        }
+    }
+
+    TEST_CASE(slerp_simd)
+    {
+        const fquat q1s[] = {
+            z_rotation(0.0f), z_rotation(0.5f), z_rotation(-1.0f),
+            fquat(0.5f, 0.5f, 0.5f, 0.5f), z_rotation(3.0f),
+            fquat(0.0f, 1.0f, 0.0f, 0.0f), z_rotation(0.1f), z_rotation(2.0f),
+        };
+        const fquat q2s[] = {
+            z_rotation(1.0f), z_rotation(-2.5f), z_rotation(1.0f),
+            fquat(-0.5f, 0.5f, -0.5f, 0.5f), z_rotation(-3.0f),
+            fquat(1.0f, 0.0f, 0.0f, 0.0f), z_rotation(0.1001f),
+            z_rotation(5.0f),
+        };
+
+        quat<float32x8> q1, q2;
+        float32x8 t;
+        for (int i = 0; i < 8; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                q1[j].data()[i] = q1s[i][j];
+                q2[j].data()[i] = q2s[i][j];
+            }
+
+            t.data()[i] = 0.125f * float(i);
+        }
+
+        const auto r1 = math::nlerp(q1, q2, t);
+        const auto r2 = math::slerp(q1, q2, t);
+        const auto r3 = math::fast_slerp(q1, q2, t);
+        for (int i = 0; i < 8; ++i)
+        {
+            const auto ti = t.data()[i];
+            test_assert(nearly_equal(
+                lane(r1, i), math::nlerp(q1s[i], q2s[i], ti), 1e-6f));
+            test_assert(nearly_equal(
+                lane(r2, i), math::slerp(q1s[i], q2s[i], ti), 1e-6f));
+            test_assert(nearly_equal(
+                lane(r3, i), math::fast_slerp(q1s[i], q2s[i], ti), 1e-6f));
+        }
+    }
 }
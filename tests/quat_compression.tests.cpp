@@ -0,0 +1,149 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/quat_compression.hpp>
+#include "tue.tests.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <tue/math.hpp>
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    std::vector<fquat> test_quats()
+    {
+        std::vector<fquat> quats = {
+            fquat(0.0f, 0.0f, 0.0f, 1.0f),
+            fquat(0.0f, 0.0f, 0.0f, -1.0f),
+            fquat(1.0f, 0.0f, 0.0f, 0.0f),
+            fquat(0.0f, -1.0f, 0.0f, 0.0f),
+            fquat(0.5f, -0.5f, 0.5f, -0.5f),
+            fquat(0.70710678f, 0.0f, -0.70710678f, 0.0f),
+        };
+
+        for (int i = 0; i < 123; ++i)
+        {
+            const auto f = float(i);
+            quats.push_back(math::normalize(fquat(
+                std::sin(f * 1.3f), std::cos(f * 0.7f),
+                std::sin(f * 2.9f + 1.0f), std::cos(f * 0.3f + 2.0f))));
+        }
+
+        return quats;
+    }
+
+    template<int Bits>
+    float max_error()
+    {
+        const auto b = Bits == 32 ? 10 : Bits == 48 ? 15 : 20;
+        return 2.0f / float((1 << b) - 2) + 0.000001f;
+    }
+
+    template<int Bits>
+    void check_round_trip(const fquat& q)
+    {
+        const auto d = decompress_quat<Bits>(compress_quat<Bits>(q));
+
+        // q and -q represent the same rotation
+        const auto dot = q[0]*d[0] + q[1]*d[1] + q[2]*d[2] + q[3]*d[3];
+        const auto s = dot < 0.0f ? -1.0f : 1.0f;
+        for (int i = 0; i < 4; ++i)
+        {
+            test_assert(std::abs(s * d[i] - q[i]) <= max_error<Bits>());
+        }
+    }
+
+    TEST_CASE(compressed_types)
+    {
+        test_assert((std::is_same<
+            decltype(compress_quat<32>(fquat())), std::uint32_t>::value));
+        test_assert((std::is_same<
+            decltype(compress_quat<48>(fquat())), std::uint64_t>::value));
+        test_assert((std::is_same<
+            decltype(compress_quat<64>(fquat())), std::uint64_t>::value));
+        test_assert((std::is_same<
+            decltype(compress_quat<32>(quat<float32x4>())),
+            uint32x4>::value));
+        test_assert((std::is_same<
+            decltype(decompress_quat<64>(simd<std::uint64_t, 8>())),
+            quat<float32x8>>::value));
+    }
+
+    TEST_CASE(compress_quat_identity)
+    {
+        const fquat identity(0.0f, 0.0f, 0.0f, 1.0f);
+        test_assert(decompress_quat<32>(compress_quat<32>(identity))
+            == identity);
+        test_assert(decompress_quat<64>(compress_quat<64>(identity))
+            == identity);
+
+        // The sign is canonicalized
+        test_assert(compress_quat<48>(fquat(0.0f, 0.0f, 0.0f, -1.0f))
+            == compress_quat<48>(identity));
+        test_assert(compress_quat<48>(identity) >> 45 == 3);
+        test_assert(compress_quat<48>(identity) < (std::uint64_t(1) << 47));
+    }
+
+    TEST_CASE(compress_quat_round_trip)
+    {
+        for (const auto& q : test_quats())
+        {
+            check_round_trip<32>(q);
+            check_round_trip<48>(q);
+            check_round_trip<64>(q);
+        }
+    }
+
+    TEST_CASE(compress_quat_simd)
+    {
+        const auto quats = test_quats();
+        for (std::size_t i = 0; i + 8 <= quats.size(); i += 8)
+        {
+            quat<float32x8> q;
+            for (int j = 0; j < 8; ++j)
+            {
+                for (int k = 0; k < 4; ++k)
+                {
+                    q[k].data()[j] = quats[i+j][k];
+                }
+            }
+
+            const auto bits32 = compress_quat<32>(q);
+            const auto bits64 = compress_quat<64>(q);
+            const auto d32 = decompress_quat<32>(bits32);
+            const auto d64 = decompress_quat<64>(bits64);
+            for (int j = 0; j < 8; ++j)
+            {
+                const auto e32 = compress_quat<32>(quats[i+j]);
+                const auto e64 = compress_quat<64>(quats[i+j]);
+                test_assert(bits32.data()[j] == e32);
+                test_assert(bits64.data()[j] == e64);
+
+                const auto f32 = decompress_quat<32>(e32);
+                const auto f64 = decompress_quat<64>(e64);
+                for (int k = 0; k < 4; ++k)
+                {
+                    test_assert(d32[k].data()[j] == f32[k]);
+                    test_assert(d64[k].data()[j] == f64[k]);
+                }
+            }
+        }
+
+        const quat<float32x4> q4(
+            float32x4(0.0f), float32x4(1.0f), float32x4(0.0f),
+            float32x4(0.0f));
+        test_assert(decompress_quat<48>(compress_quat<48>(q4)) == q4);
+    }
+}
@@ -0,0 +1,217 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/skinning.hpp>
+#include "tue.tests.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <tue/mat.hpp>
+#include <tue/math.hpp>
+#include <tue/memory.hpp>
+#include <tue/simd.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    constexpr std::size_t vertex_count = 21;
+
+    std::vector<fmat4x3> test_bones()
+    {
+        std::vector<fmat4x3> bones;
+        for (int i = 0; i < 5; ++i)
+        {
+            const auto f = float(i);
+            auto m = transform::rotation_mat<float, 4, 3>(
+                fvec3(std::sin(f), 1.0f, std::cos(f)), 0.4f * f);
+            m[3] = fvec3(f, -2.0f * f, 0.5f);
+            bones.push_back(m);
+        }
+
+        return bones;
+    }
+
+    template<int K>
+    struct test_mesh
+    {
+        std::vector<std::uint16_t> indices;
+        std::vector<float> weights;
+        std::vector<fvec3> positions;
+        std::vector<fvec3> normals;
+
+        test_mesh()
+        {
+            for (std::size_t i = 0; i < vertex_count; ++i)
+            {
+                const auto f = float(i);
+                float total = 0.0f;
+                for (int k = 0; k < K; ++k)
+                {
+                    indices.push_back(std::uint16_t((i + 2*k) % 5));
+                    weights.push_back(1.0f + float(k));
+                    total += 1.0f + float(k);
+                }
+
+                for (int k = 0; k < K; ++k)
+                {
+                    weights[i*K + k] /= total;
+                }
+
+                positions.push_back(fvec3(
+                    std::sin(f * 1.3f) * 4.0f,
+                    std::cos(f * 0.7f) * 3.0f,
+                    std::sin(f * 2.9f + 1.0f) * 5.0f));
+                normals.push_back(math::normalize(fvec3(
+                    std::cos(f), 0.5f, std::sin(f))));
+            }
+        }
+
+        fmat4x3 skinning_mat(const fmat4x3* bones, std::size_t i) const
+        {
+            auto m = fmat4x3::zero();
+            for (int k = 0; k < K; ++k)
+            {
+                m += bones[indices[i*K + k]] * weights[i*K + k];
+            }
+
+            return m;
+        }
+    };
+
+    template<int K, int W>
+    void check_linear_blend()
+    {
+        const auto bones = test_bones();
+        const test_mesh<K> mesh;
+        std::vector<fvec3> positions(vertex_count);
+        std::vector<fvec3> normals(vertex_count);
+        skinning::linear_blend<K, W>(
+            bones.data(), mesh.indices.data(), mesh.weights.data(),
+            mesh.positions.data(), mesh.normals.data(),
+            positions.data(), normals.data(), vertex_count);
+
+        for (std::size_t i = 0; i < vertex_count; ++i)
+        {
+            const auto m = mesh.skinning_mat(bones.data(), i);
+            test_assert(nearly_equal(
+                positions[i], m * fvec4(mesh.positions[i], 1.0f), 1e-4f));
+            test_assert(nearly_equal(
+                normals[i],
+                math::normalize(fmat3x3(m) * mesh.normals[i]), 1e-4f));
+        }
+    }
+
+    TEST_CASE(linear_blend)
+    {
+        check_linear_blend<1, 4>();
+        check_linear_blend<1, 8>();
+        check_linear_blend<4, 4>();
+        check_linear_blend<4, 8>();
+        check_linear_blend<8, 8>();
+    }
+
+    TEST_CASE(linear_blend_ranges)
+    {
+        const auto bones = test_bones();
+        const test_mesh<4> mesh;
+        std::vector<fvec3> expected(vertex_count);
+        skinning::linear_blend<4>(
+            bones.data(), mesh.indices.data(), mesh.weights.data(),
+            mesh.positions.data(), nullptr,
+            expected.data(), nullptr, vertex_count);
+
+        // Skin in place in two uneven ranges
+        auto positions = mesh.positions;
+        auto normals = mesh.normals;
+        skinning::linear_blend<4>(
+            bones.data(), mesh.indices.data(), mesh.weights.data(),
+            positions.data(), normals.data(),
+            positions.data(), normals.data(), 0, 11);
+        skinning::linear_blend<4>(
+            bones.data(), mesh.indices.data(), mesh.weights.data(),
+            positions.data(), normals.data(),
+            positions.data(), normals.data(), 11, vertex_count);
+
+        test_assert(positions == expected);
+    }
+
+    template<int K, int W>
+    void check_linear_blend_blocks()
+    {
+        using S = simd<float, W>;
+        using vec3_blocks = std::vector<vec3<S>, aligned_allocator<vec3<S>>>;
+
+        const auto bones = test_bones();
+        const test_mesh<K> mesh;
+        std::vector<fvec3> expected_positions(vertex_count);
+        std::vector<fvec3> expected_normals(vertex_count);
+        skinning::linear_blend<K, W>(
+            bones.data(), mesh.indices.data(), mesh.weights.data(),
+            mesh.positions.data(), mesh.normals.data(),
+            expected_positions.data(), expected_normals.data(),
+            vertex_count);
+
+        const auto block_count = (vertex_count + W - 1) / W;
+        vec3_blocks positions(block_count, vec3<S>(S::zero()));
+        vec3_blocks normals(block_count, vec3<S>(S::zero()));
+        for (std::size_t i = 0; i < vertex_count; ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                positions[i/W][c].data()[i%W] = mesh.positions[i][c];
+                normals[i/W][c].data()[i%W] = mesh.normals[i][c];
+            }
+        }
+
+        vec3_blocks out_positions(block_count);
+        vec3_blocks out_normals(block_count);
+        skinning::linear_blend<K, W>(
+            bones.data(), mesh.indices.data(), mesh.weights.data(),
+            positions.data(), normals.data(),
+            out_positions.data(), out_normals.data(), vertex_count);
+
+        // Skin in place in two ranges, without normals
+        skinning::linear_blend<K, W>(
+            bones.data(), mesh.indices.data(), mesh.weights.data(),
+            positions.data(), nullptr,
+            positions.data(), nullptr, 0, W);
+        skinning::linear_blend<K, W>(
+            bones.data(), mesh.indices.data(), mesh.weights.data(),
+            positions.data(), nullptr,
+            positions.data(), nullptr, W, vertex_count);
+
+        for (std::size_t i = 0; i < vertex_count; ++i)
+        {
+            fvec3 p, n, q;
+            for (int c = 0; c < 3; ++c)
+            {
+                p[c] = out_positions[i/W][c].data()[i%W];
+                n[c] = out_normals[i/W][c].data()[i%W];
+                q[c] = positions[i/W][c].data()[i%W];
+            }
+
+            test_assert(nearly_equal(p, expected_positions[i], 1e-4f));
+            test_assert(nearly_equal(n, expected_normals[i], 1e-4f));
+            test_assert(q == p);
+        }
+    }
+
+    TEST_CASE(linear_blend_blocks)
+    {
+        check_linear_blend_blocks<1, 4>();
+        check_linear_blend_blocks<4, 4>();
+        check_linear_blend_blocks<4, 8>();
+        check_linear_blend_blocks<8, 8>();
+    }
+}
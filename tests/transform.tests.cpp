@@ -9,7 +9,13 @@
 #include <tue/transform.hpp>
 #include "tue.tests.hpp"
 
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <tue/mat.hpp>
 #include <tue/math.hpp>
+#include <tue/memory.hpp>
 #include <tue/quat.hpp>
 #include <tue/vec.hpp>
 
@@ -220,6 +226,135 @@ namespace
         test_assert(m2 == dmat3x3(m1));
     }
 
+    // Each component gets a turn at being the largest
+    const dquat test_quats[] = {
+        math::normalize(dquat(0.9, 0.1, -0.2, 0.3)),
+        math::normalize(dquat(0.1, -0.9, 0.2, 0.3)),
+        math::normalize(dquat(-0.1, 0.2, 0.9, 0.3)),
+        math::normalize(dquat(0.1, 0.2, 0.3, -0.9)),
+        math::normalize(dquat(-0.5, 0.6, -0.2, 0.7)),
+        math::normalize(dquat(0.3, 0.3, -0.6, 0.5)),
+        math::normalize(dquat(0.1, -0.1, 0.1, 0.9)),
+        dquat::identity(),
+    };
+
+    // q and -q are the same rotation
+    template<typename T>
+    bool same_rotation(const quat<T>& q1, const quat<T>& q2, T epsilon)
+    {
+        const auto d = math::dot(q1.xyzw(), q2.xyzw());
+        return math::abs(math::abs(d) - T(1)) < epsilon;
+    }
+
+    template<typename T, int N>
+    quat<simd<T, N>> pack_quats(const quat<T>* qs)
+    {
+        quat<simd<T, N>> result;
+        for (int i = 0; i < N; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                result[j].data()[i] = qs[i][j];
+            }
+        }
+
+        return result;
+    }
+
+    TEST_CASE(rotation_quat_from_rotation_mat)
+    {
+        fquat fqs[8];
+        fmat3x3 fms[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            const auto& q = test_quats[i];
+            const auto m = transform::rotation_mat(q);
+            const auto q2 = transform::rotation_quat(m);
+            test_assert(same_rotation(q2, q, 1e-12));
+            test_assert(nearly_equal(math::length(q2.xyzw()), 1.0));
+
+            const auto q3 = transform::rotation_quat(dmat3x3(m));
+            test_assert(q3 == q2);
+
+            fqs[i] = fquat(q);
+            fms[i] = fmat3x3(dmat3x3(m));
+        }
+
+        const auto ms = pack_mats<4>(fms);
+        const auto q4 = transform::rotation_quat(ms);
+        for (int i = 0; i < 4; ++i)
+        {
+            const fquat q(
+                q4[0].data()[i], q4[1].data()[i],
+                q4[2].data()[i], q4[3].data()[i]);
+            test_assert(same_rotation(q, fqs[i], 1e-5f));
+        }
+    }
+
+    TEST_CASE(axis_angle_from_rotation_quat)
+    {
+        for (const auto& q : test_quats)
+        {
+            const auto aa = transform::axis_angle(q);
+            test_assert(aa[3] >= 0.0);
+            test_assert(same_rotation(
+                transform::rotation_quat(aa), q, 1e-12));
+        }
+
+        const auto aa = transform::axis_angle(dquat::identity());
+        test_assert(aa == dvec4(0.0, 0.0, 1.0, 0.0));
+
+        fquat fqs[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            fqs[i] = fquat(test_quats[i]);
+        }
+
+        const auto aas = transform::axis_angle(pack_quats<float, 8>(fqs));
+        for (int i = 0; i < 8; ++i)
+        {
+            const auto expected = transform::axis_angle(fqs[i]);
+            for (int j = 0; j < 4; ++j)
+            {
+                test_assert(
+                    math::abs(aas[j].data()[i] - expected[j]) < 1e-5f);
+            }
+        }
+    }
+
+    TEST_CASE(euler_angles)
+    {
+        for (const auto& q : test_quats)
+        {
+            const auto e = transform::euler_angles(q);
+            const auto m = transform::rotation_mat(1.0, 0.0, 0.0, e[0])
+                * transform::rotation_mat(0.0, 1.0, 0.0, e[1])
+                * transform::rotation_mat(0.0, 0.0, 1.0, e[2]);
+            const auto expected = transform::rotation_mat(q);
+            for (int c = 0; c < 4; ++c)
+            {
+                test_assert(math::length(m[c] - expected[c]) < 1e-12);
+            }
+        }
+
+        fquat fqs[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            fqs[i] = fquat(test_quats[i]);
+        }
+
+        const auto es = transform::euler_angles(pack_quats<float, 8>(fqs));
+        for (int i = 0; i < 8; ++i)
+        {
+            const auto expected = transform::euler_angles(fqs[i]);
+            for (int j = 0; j < 3; ++j)
+            {
+                test_assert(
+                    math::abs(es[j].data()[i] - expected[j]) < 1e-5f);
+            }
+        }
+    }
+
     TEST_CASE(scale_mat_2d)
     {
         CONST_OR_CONSTEXPR auto m1 =
@@ -264,6 +399,86 @@ namespace
         test_assert(m4 == m2);
     }
 
+    const dvec3 trs_t(1.2, -3.4, 5.6);
+    const dvec3 trs_s(0.5, 2.0, 3.5);
+
+    TEST_CASE(trs_mat)
+    {
+        for (const auto& q : test_quats)
+        {
+            const auto m1 = transform::trs_mat(trs_t, q, trs_s);
+            const auto m2 = transform::scale_mat(trs_s)
+                * transform::rotation_mat(q)
+                * transform::translation_mat(trs_t);
+            for (int c = 0; c < 4; ++c)
+            {
+                test_assert(math::length(m1[c] - m2[c]) < 1e-12);
+            }
+
+            const auto m3 = transform::trs_mat<double, 3, 4>(trs_t, q, trs_s);
+            test_assert(m3 == dmat3x4(m1));
+        }
+
+        const auto ts = dvec3(1.0, 2.0, 3.0);
+        const auto m = transform::trs_mat(ts, test_quats[0], trs_s);
+        const auto p = dvec3(0.3, -0.7, 1.9);
+        const auto expected = (p * trs_s)
+            * transform::rotation_mat<double, 3, 3>(test_quats[0]) + ts;
+        test_assert(math::length(
+            transform::transform_point(m, p) - expected) < 1e-12);
+    }
+
+    TEST_CASE(decompose_trs)
+    {
+        for (const auto& q : test_quats)
+        {
+            dvec3 t, s;
+            dquat q2;
+            transform::decompose_trs(
+                transform::trs_mat(trs_t, q, trs_s), t, q2, s);
+            test_assert(math::length(t - trs_t) < 1e-12);
+            test_assert(math::length(s - trs_s) < 1e-12);
+            test_assert(same_rotation(q2, q, 1e-12));
+
+            // A mirrored matrix comes back with a negative scale
+            transform::decompose_trs(
+                transform::trs_mat<double, 3, 4>(trs_t, q, -trs_s),
+                t, q2, s);
+            test_assert(math::length(s + trs_s) < 1e-12);
+            test_assert(same_rotation(q2, q, 1e-12));
+        }
+
+        // 8 at once
+        fquat fqs[8];
+        fmat4x4 fms[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            fqs[i] = fquat(test_quats[i]);
+            fms[i] = fmat4x4(transform::trs_mat(
+                trs_t * double(i), test_quats[i], trs_s + double(i)));
+        }
+
+        using S = simd<float, 8>;
+        vec3<S> ts, ss;
+        quat<S> qs;
+        transform::decompose_trs(pack_mats<8>(fms), ts, qs, ss);
+
+        fmat4x4 fms2[8];
+        unpack_mats(transform::trs_mat(ts, qs, ss), fms2);
+        for (int i = 0; i < 8; ++i)
+        {
+            const fquat q(
+                qs[0].data()[i], qs[1].data()[i],
+                qs[2].data()[i], qs[3].data()[i]);
+            test_assert(same_rotation(q, fqs[i], 1e-5f));
+
+            for (int c = 0; c < 4; ++c)
+            {
+                test_assert(math::length(fms2[i][c] - fms[i][c]) < 1e-4f);
+            }
+        }
+    }
+
     TEST_CASE(perspective_mat)
     {
         const auto m1 = transform::perspective_mat(1.2, 3.4, 5.6, 7.8);
@@ -314,4 +529,273 @@ namespace
         const auto m2 = transform::ortho_mat<double, 3, 4>(1.2, 3.4, 5.6, 7.8);
         test_assert(m2 == dmat3x4(m2));
     }
+
+    std::vector<fvec3> test_points()
+    {
+        std::vector<fvec3> points;
+        for (int i = 0; i < 21; ++i)
+        {
+            const auto f = float(i);
+            points.push_back(fvec3(
+                std::sin(f * 1.3f) * 4.0f,
+                std::cos(f * 0.7f) * 3.0f,
+                std::sin(f * 2.9f + 1.0f) * 5.0f - 12.0f));
+        }
+
+        return points;
+    }
+
+    const fmat4x4 batch_mat = transform::scale_mat(2.0f, 0.5f, 3.0f)
+        * transform::rotation_mat(0.6f, 0.0f, 0.8f, 1.1f)
+        * transform::translation_mat(1.0f, -2.0f, 3.0f);
+
+    TEST_CASE(transform_point)
+    {
+        const auto m34 = fmat3x4(batch_mat);
+        const auto m43 = fmat4x3(math::transpose(batch_mat));
+        for (const auto& p : test_points())
+        {
+            const auto expected = (fvec4(p, 1.0f) * batch_mat).xyz();
+            test_assert(nearly_equal(
+                transform::transform_point(batch_mat, p), expected, 1e-4f));
+            test_assert(nearly_equal(
+                transform::transform_point(m34, p), expected, 1e-4f));
+            test_assert(nearly_equal(
+                transform::transform_point(m43, p), expected, 1e-4f));
+
+            const auto expected_v = (fvec4(p, 0.0f) * batch_mat).xyz();
+            test_assert(nearly_equal(
+                transform::transform_vector(batch_mat, p), expected_v, 1e-4f));
+            test_assert(nearly_equal(
+                transform::transform_vector(m34, p), expected_v, 1e-4f));
+            test_assert(nearly_equal(
+                transform::transform_vector(m43, p), expected_v, 1e-4f));
+        }
+
+        CONST_OR_CONSTEXPR auto t = transform::translation_mat<double, 3, 4>(
+            1.0, 2.0, 3.0);
+        CONST_OR_CONSTEXPR auto p = transform::transform_point(
+            t, dvec3(1.0, 1.0, 1.0));
+        test_assert(p == dvec3(2.0, 3.0, 4.0));
+        test_assert(transform::transform_vector(t, dvec3(1.0, 1.0, 1.0))
+            == dvec3(1.0, 1.0, 1.0));
+    }
+
+    TEST_CASE(transform_points)
+    {
+        const auto points = test_points();
+        std::vector<fvec3> out(points.size());
+        transform::transform_points(
+            batch_mat, points.data(), points.size(), out.data());
+
+        const auto m34 = fmat3x4(batch_mat);
+        std::vector<fvec3> out34(points.size());
+        transform::transform_points(
+            m34, points.data(), points.size(), out34.data());
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const auto expected = (fvec4(points[i], 1.0f) * batch_mat).xyz();
+            test_assert(nearly_equal(out[i], expected, 1e-4f));
+            test_assert(out34[i] == out[i]);
+        }
+
+        // In place
+        auto in_place = points;
+        transform::transform_points(
+            batch_mat, in_place.data(), in_place.size(), in_place.data());
+        test_assert(in_place == out);
+    }
+
+    TEST_CASE(transform_points_strided)
+    {
+        struct vertex
+        {
+            fvec3 position;
+            fvec2 uv;
+        };
+
+        const auto points = test_points();
+        std::vector<vertex> vertices;
+        for (const auto& p : points)
+        {
+            vertices.push_back({ p, fvec2(7.0f, 8.0f) });
+        }
+
+        std::vector<fvec3> out(points.size());
+        transform::transform_points(
+            batch_mat, &vertices[0].position, sizeof(vertex),
+            vertices.size(), out.data(), sizeof(fvec3));
+        transform::transform_points(
+            batch_mat, &vertices[0].position, sizeof(vertex),
+            vertices.size(), &vertices[0].position, sizeof(vertex));
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const auto expected = (fvec4(points[i], 1.0f) * batch_mat).xyz();
+            test_assert(nearly_equal(out[i], expected, 1e-4f));
+            test_assert(vertices[i].position == out[i]);
+            test_assert(vertices[i].uv == fvec2(7.0f, 8.0f));
+        }
+    }
+
+    TEST_CASE(transform_points_quat)
+    {
+        const auto q = transform::rotation_quat(0.6f, 0.0f, 0.8f, 1.1f);
+        const fvec3 t(1.0f, -2.0f, 3.0f);
+        const auto points = test_points();
+        std::vector<fvec3> out(points.size());
+        std::vector<fvec3> vectors(points.size());
+        transform::transform_points(
+            q, t, points.data(), points.size(), out.data());
+        transform::transform_vectors(
+            q, points.data(), points.size(), vectors.data());
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            test_assert(nearly_equal(out[i], points[i] * q + t, 1e-4f));
+            test_assert(nearly_equal(vectors[i], points[i] * q, 1e-4f));
+        }
+    }
+
+    TEST_CASE(transform_vectors_quats)
+    {
+        const auto vectors = test_points();
+        std::vector<fquat> qs;
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+        {
+            qs.push_back(transform::rotation_quat(
+                fvec3(0.6f, 0.0f, 0.8f), 0.3f * float(i)));
+        }
+
+        auto out = vectors;
+        transform::transform_vectors(
+            qs.data(), out.data(), out.size(), out.data());
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+        {
+            test_assert(nearly_equal(out[i], vectors[i] * qs[i], 1e-4f));
+        }
+
+        // Structure-of-arrays blocks of eight
+        using S = simd<float, 8>;
+        using vec3_blocks = std::vector<vec3<S>, aligned_allocator<vec3<S>>>;
+        vec3_blocks blocks(2, vec3<S>(S::zero()));
+        std::vector<quat<S>, aligned_allocator<quat<S>>> block_qs(
+            2, quat<S>(S::zero(), S::zero(), S::zero(), S::zero()));
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                block_qs[i/8][k].data()[i%8] = qs[i][k];
+            }
+
+            for (int k = 0; k < 3; ++k)
+            {
+                blocks[i/8][k].data()[i%8] = vectors[i][k];
+            }
+        }
+
+        vec3_blocks out1(2), out2(2);
+        transform::transform_vectors(qs[3], blocks.data(), 2, out1.data());
+        transform::transform_vectors(
+            block_qs.data(), blocks.data(), 2, out2.data());
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            const auto& r1 = out1[i/8];
+            const auto& r2 = out2[i/8];
+            const auto j = i % 8;
+            test_assert(nearly_equal(
+                fvec3(r1[0].data()[j], r1[1].data()[j], r1[2].data()[j]),
+                vectors[i] * qs[3], 1e-4f));
+            test_assert(nearly_equal(
+                fvec3(r2[0].data()[j], r2[1].data()[j], r2[2].data()[j]),
+                vectors[i] * qs[i], 1e-4f));
+        }
+    }
+
+    TEST_CASE(transform_vectors)
+    {
+        const auto vectors = test_points();
+        std::vector<fvec3> out(vectors.size());
+        transform::transform_vectors(
+            batch_mat, vectors.data(), vectors.size(), out.data());
+
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+        {
+            const auto expected = (fvec4(vectors[i], 0.0f) * batch_mat).xyz();
+            test_assert(nearly_equal(out[i], expected, 1e-4f));
+        }
+    }
+
+    TEST_CASE(transform_normals)
+    {
+        // Normals stay perpendicular to transformed tangents
+        const auto tangents = test_points();
+        std::vector<fvec3> normals;
+        for (const auto& t : tangents)
+        {
+            normals.push_back(math::normalize(
+                math::cross(t, fvec3(0.3f, -0.2f, 1.0f))));
+        }
+
+        std::vector<fvec3> out(normals.size());
+        transform::transform_normals(
+            batch_mat, normals.data(), normals.size(), out.data());
+
+        for (std::size_t i = 0; i < normals.size(); ++i)
+        {
+            const auto t = (fvec4(tangents[i], 0.0f) * batch_mat).xyz();
+            test_assert(math::abs(math::length(out[i]) - 1.0f) < 0.001f);
+            test_assert(math::abs(
+                math::dot(out[i], math::normalize(t))) < 0.001f);
+        }
+    }
+
+    TEST_CASE(transform_vectors_mat4x3)
+    {
+        // A mat4x3 transforms column vectors, like with transform_vector()
+        const fmat4x3 m43(
+            fvec3(1.0f, 0.0f, 0.0f),
+            fvec3(0.0f, 0.0f, 1.0f),
+            fvec3(0.0f, -1.0f, 0.0f),
+            fvec3(5.0f, 6.0f, 7.0f));
+        const fvec3 v(0.0f, 1.0f, 0.0f);
+        test_assert(transform::transform_vector(m43, v)
+            == fvec3(0.0f, 0.0f, 1.0f));
+
+        fvec3 out;
+        transform::transform_vectors(m43, &v, 1, &out);
+        test_assert(out == fvec3(0.0f, 0.0f, 1.0f));
+
+        transform::transform_normals(m43, &v, 1, &out);
+        test_assert(nearly_equal(out, fvec3(0.0f, 0.0f, 1.0f), 1e-6f));
+
+        // A mat3x4 with the same transformation transforms row vectors
+        const auto m34 = math::transpose(m43);
+        test_assert(transform::transform_vector(m34, v)
+            == fvec3(0.0f, 0.0f, 1.0f));
+
+        transform::transform_vectors(m34, &v, 1, &out);
+        test_assert(out == fvec3(0.0f, 0.0f, 1.0f));
+
+        transform::transform_normals(m34, &v, 1, &out);
+        test_assert(nearly_equal(out, fvec3(0.0f, 0.0f, 1.0f), 1e-6f));
+    }
+
+    TEST_CASE(project_points)
+    {
+        const auto m = batch_mat
+            * transform::perspective_mat(1.2f, 1.5f, 0.1f, 100.0f);
+        const auto points = test_points();
+        std::vector<fvec3> out(points.size());
+        transform::project_points(
+            m, points.data(), points.size(), out.data());
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const auto p = fvec4(points[i], 1.0f) * m;
+            const auto expected = p.xyz() / p[3];
+            test_assert(nearly_equal(out[i], expected, 1e-4f));
+        }
+    }
 }
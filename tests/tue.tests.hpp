@@ -13,6 +13,10 @@
 #include <cmath>
 #include <limits>
 
+#include <tue/mat.hpp>
+#include <tue/quat.hpp>
+#include <tue/vec.hpp>
+
 #ifdef _MSC_VER
 #define CONST_OR_CONSTEXPR const
 #else
@@ -28,4 +32,45 @@ namespace
             || std::abs(actual - expected) < std::abs(expected * 0.0003f)
             || std::abs(expected) == std::numeric_limits<T>::infinity();
     }
+
+    template<typename T, int N>
+    bool nearly_equal(
+        const tue::vec<T, N>& actual, const tue::vec<T, N>& expected,
+        T epsilon) noexcept
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            if (!(std::abs(actual[i] - expected[i]) < epsilon))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename T, int C, int R>
+    bool nearly_equal(
+        const tue::mat<T, C, R>& actual, const tue::mat<T, C, R>& expected,
+        T epsilon) noexcept
+    {
+        for (int c = 0; c < C; ++c)
+        {
+            if (!nearly_equal(actual[c], expected[c], epsilon))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    bool nearly_equal(
+        const tue::quat<T>& actual, const tue::quat<T>& expected,
+        T epsilon) noexcept
+    {
+        return nearly_equal(actual.v(), expected.v(), epsilon)
+            && std::abs(actual.s() - expected.s()) < epsilon;
+    }
 }